@@ -0,0 +1,32 @@
+#include "Arduino.h"
+
+static unsigned long long hostMicros = 0;
+
+unsigned long millis(void) {
+  return hostMicros / 1000;
+}
+
+unsigned long micros(void) {
+  return hostMicros;
+}
+
+void delay(unsigned long ms) {
+  hostMicros += ms * 1000ULL;
+}
+
+void delayMicroseconds(unsigned int us) {
+  hostMicros += us;
+}
+
+void yield(void) {
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+}
+
+void hostAdvanceMicros(unsigned long us) {
+  hostMicros += us;
+}
@@ -0,0 +1,85 @@
+/**
+ * Minimal stand-in for the Arduino core so the display library can be
+ * compiled and benchmarked on a development machine.
+ *
+ * Time is virtual: millis()/micros() only advance through delay() and
+ * through the emulated I2C bus (see SSD1306Emulator), which makes bus
+ * bound code behave like it would on the ESP8266.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/types.h>
+
+#include <string>
+
+#define PROGMEM
+
+#define pgm_read_byte(addr)  (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define memcpy_P(dest, src, n) memcpy((dest), (src), (n))
+
+typedef uint8_t byte;
+
+#define LOW    0
+#define HIGH   1
+#define INPUT  0
+#define OUTPUT 1
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+
+template <typename T, typename U>
+inline T min(T a, U b) { return (b < a) ? b : a; }
+
+template <typename T, typename U>
+inline T max(T a, U b) { return (a < b) ? b : a; }
+
+// Virtual clock
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield(void);
+
+// Advance the virtual clock, used by the emulated peripherals
+void hostAdvanceMicros(unsigned long us);
+
+class String {
+  private:
+    std::string s;
+
+  public:
+    String(const char *str = "") : s(str ? str : "") {}
+    String(const std::string &str) : s(str) {}
+    String(int value) : s(std::to_string(value)) {}
+    String(unsigned int value) : s(std::to_string(value)) {}
+    String(long value) : s(std::to_string(value)) {}
+    String(unsigned long value) : s(std::to_string(value)) {}
+
+    unsigned int length(void) const { return s.length(); }
+    const char* c_str() const { return s.c_str(); }
+
+    void toCharArray(char *buf, unsigned int bufsize) const {
+      if (!bufsize || !buf) return;
+      unsigned int n = min(bufsize - 1, (unsigned int) s.length());
+      memcpy(buf, s.c_str(), n);
+      buf[n] = 0;
+    }
+
+    bool equals(const String &other) const { return s == other.s; }
+    bool endsWith(const String &suffix) const {
+      return s.length() >= suffix.s.length() &&
+             s.compare(s.length() - suffix.s.length(), suffix.s.length(), suffix.s) == 0;
+    }
+
+    String& operator+=(const String &rhs) { s += rhs.s; return *this; }
+
+    friend String operator+(const String &lhs, const String &rhs) { return String(lhs.s + rhs.s); }
+    friend String operator+(const char *lhs, const String &rhs) { return String(lhs + rhs.s); }
+};
@@ -0,0 +1,19 @@
+/**
+ * Stand-in for the ESP8266 SPI library, it only lets SSD1306Spi compile.
+ * Use SSD1306MockTransport to emulate a display on an SPI bus.
+ */
+
+#pragma once
+
+#include "Arduino.h"
+
+class SPIClass {
+  public:
+    void begin(void) {}
+    void end(void) {}
+    void setFrequency(uint32_t frequency) {}
+    uint8_t transfer(uint8_t data) { return 0; }
+    void writeBytes(uint8_t *data, uint32_t size) {}
+};
+
+extern SPIClass SPI;
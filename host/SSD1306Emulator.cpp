@@ -0,0 +1,198 @@
+#include "SSD1306Emulator.h"
+
+SSD1306Emulator::SSD1306Emulator(uint8_t address) {
+  this->address = address;
+  reset();
+}
+
+void SSD1306Emulator::attach(TwoWire &wire) {
+  this->wire = &wire;
+  wire.attach(this);
+}
+
+void SSD1306Emulator::reset(void) {
+  for (uint16_t i = 0; i < EMULATOR_GDDRAM_SIZE; i++) {
+    gddram[i] = (uint8_t) (i * 151 + 17);
+  }
+  memoryMode   = 2;
+  columnStart  = 0;
+  columnEnd    = EMULATOR_WIDTH - 1;
+  pageStart    = 0;
+  pageEnd      = EMULATOR_PAGES - 1;
+  column       = 0;
+  page         = 0;
+  argsExpected = 0;
+  argsReceived = 0;
+  on           = false;
+  resetStats();
+}
+
+void SSD1306Emulator::resetStats(void) {
+  stats = SSD1306EmulatorStats();
+}
+
+uint8_t SSD1306Emulator::argumentCount(uint8_t com) {
+  switch (com) {
+    case 0x20: // MEMORYMODE
+    case 0x81: // SETCONTRAST
+    case 0x8D: // CHARGEPUMP
+    case 0xA8: // SETMULTIPLEX
+    case 0xD3: // SETDISPLAYOFFSET
+    case 0xD5: // SETDISPLAYCLOCKDIV
+    case 0xD9: // SETPRECHARGE
+    case 0xDA: // SETCOMPINS
+    case 0xDB: // SETVCOMDETECT
+      return 1;
+    case 0x21: // COLUMNADDR
+    case 0x22: // PAGEADDR
+    case 0xA3: // Vertical scroll area
+      return 2;
+    case 0x29: // Vertical and horizontal scroll
+    case 0x2A:
+      return 5;
+    case 0x26: // Horizontal scroll
+    case 0x27:
+      return 6;
+  }
+  return 0;
+}
+
+void SSD1306Emulator::executeCommand(uint8_t com, const uint8_t *args) {
+  switch (com) {
+    case 0x20:
+      memoryMode = args[0] & 0x03;
+      return;
+    case 0x21:
+      columnStart = args[0] & 0x7F;
+      columnEnd   = args[1] & 0x7F;
+      column      = columnStart;
+      return;
+    case 0x22:
+      pageStart = args[0] & 0x07;
+      pageEnd   = args[1] & 0x07;
+      page      = pageStart;
+      return;
+    case 0xAE:
+      on = false;
+      return;
+    case 0xAF:
+      on = true;
+      return;
+  }
+
+  // Page addressing mode only commands
+  if (com <= 0x0F) {
+    column = (column & 0xF0) | com;
+  } else if (com >= 0x10 && com <= 0x17) {
+    column = (column & 0x0F) | ((com & 0x07) << 4);
+  } else if (com >= 0xB0 && com <= 0xB7) {
+    page = com & 0x07;
+  }
+}
+
+void SSD1306Emulator::command(uint8_t com) {
+  stats.commandBytes++;
+
+  if (argsExpected) {
+    args[argsReceived++] = com;
+    if (argsReceived == argsExpected) {
+      argsExpected = 0;
+      executeCommand(pendingCommand, args);
+    }
+    return;
+  }
+
+  uint8_t count = argumentCount(com);
+  if (count) {
+    pendingCommand = com;
+    argsExpected   = count;
+    argsReceived   = 0;
+  } else {
+    executeCommand(com, NULL);
+  }
+}
+
+void SSD1306Emulator::data(uint8_t value) {
+  stats.dataBytes++;
+
+  gddram[page * EMULATOR_WIDTH + column] = value;
+
+  switch (memoryMode) {
+    case 0: // Horizontal
+      if (column >= columnEnd) {
+        column = columnStart;
+        page = page >= pageEnd ? pageStart : page + 1;
+      } else {
+        column++;
+      }
+      break;
+    case 1: // Vertical
+      if (page >= pageEnd) {
+        page = pageStart;
+        column = column >= columnEnd ? columnStart : column + 1;
+      } else {
+        page++;
+      }
+      break;
+    default: // Page
+      if (column < EMULATOR_WIDTH - 1) column++;
+      break;
+  }
+}
+
+void SSD1306Emulator::transaction(size_t length, uint32_t clock) {
+  stats.transactions++;
+  stats.wireBytes += length + 1;
+
+  // Start, address + ack, payload + acks, stop
+  accountBusTime(((length + 1) * 9 + 2) * 1000000.0 / clock);
+}
+
+void SSD1306Emulator::spiTransfer(size_t length, uint32_t clock) {
+  stats.transactions++;
+  stats.wireBytes += length;
+  accountBusTime(length * 8 * 1000000.0 / clock);
+}
+
+void SSD1306Emulator::accountBusTime(double micros) {
+  stats.busMicros += micros;
+
+  busRemainder += micros;
+  unsigned long whole = (unsigned long) busRemainder;
+  busRemainder -= whole;
+  hostAdvanceMicros(whole);
+}
+
+void SSD1306Emulator::receive(uint8_t address, const uint8_t *payload, size_t length, size_t dropped) {
+  if (address != this->address) return;
+
+  stats.droppedBytes += dropped;
+  transaction(length, wire ? wire->getClock() : 100000);
+
+  size_t i = 0;
+  while (i < length) {
+    uint8_t control = payload[i++];
+    bool isData = control & 0x40;
+
+    if (control & 0x80) {
+      // Co = 1: exactly one byte follows before the next control byte
+      if (i < length) {
+        isData ? data(payload[i]) : command(payload[i]);
+        i++;
+      }
+    } else {
+      // Co = 0: the remaining bytes are all data or all commands
+      for (; i < length; i++) {
+        isData ? data(payload[i]) : command(payload[i]);
+      }
+    }
+  }
+}
+
+uint16_t SSD1306Emulator::compare(const uint8_t *buffer) const {
+  uint16_t differences = 0;
+  for (uint16_t i = 0; i < EMULATOR_GDDRAM_SIZE; i++) {
+    differences += gddram[i] != buffer[i];
+  }
+  return differences;
+}
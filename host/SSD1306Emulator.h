@@ -0,0 +1,90 @@
+/**
+ * Emulates the I2C side of a 128x64 SSD1306: control bytes, the command
+ * set used by the library and the 1 KB GDDRAM with all three addressing
+ * modes. It also keeps the numbers needed for benchmarking, i.e. how many
+ * transactions and bytes went over the wire and how long that would take
+ * at the configured bus clock.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#define EMULATOR_WIDTH  128
+#define EMULATOR_PAGES  8
+#define EMULATOR_GDDRAM_SIZE (EMULATOR_WIDTH * EMULATOR_PAGES)
+
+struct SSD1306EmulatorStats {
+  uint32_t transactions = 0;
+  // Bytes on the wire including the address and control bytes
+  uint32_t wireBytes    = 0;
+  uint32_t commandBytes = 0;
+  uint32_t dataBytes    = 0;
+  // Bytes refused because the Wire buffer was full
+  uint32_t droppedBytes = 0;
+  // Estimated time the bus was busy
+  double   busMicros    = 0;
+};
+
+class SSD1306Emulator : public TwoWireDevice {
+  private:
+    uint8_t              address;
+    TwoWire             *wire = NULL;
+
+    uint8_t              gddram[EMULATOR_GDDRAM_SIZE];
+
+    uint8_t              memoryMode  = 2; // Page addressing after reset
+    uint8_t              columnStart = 0;
+    uint8_t              columnEnd   = EMULATOR_WIDTH - 1;
+    uint8_t              pageStart   = 0;
+    uint8_t              pageEnd     = EMULATOR_PAGES - 1;
+    uint8_t              column      = 0;
+    uint8_t              page        = 0;
+
+    // Multi byte command parsing
+    uint8_t              pendingCommand = 0;
+    uint8_t              argsExpected   = 0;
+    uint8_t              argsReceived   = 0;
+    uint8_t              args[6];
+
+    bool                 on = false;
+
+    SSD1306EmulatorStats stats;
+    double               busRemainder = 0;
+
+    void    accountBusTime(double micros);
+
+    uint8_t argumentCount(uint8_t command);
+    void    executeCommand(uint8_t command, const uint8_t *args);
+
+  public:
+    SSD1306Emulator(uint8_t address = 0x3C);
+
+    // Listen on the given bus
+    void attach(TwoWire &wire);
+
+    // Forget all state, GDDRAM is filled with noise like after power up
+    void reset(void);
+
+    // Feed a single command or data byte
+    void command(uint8_t com);
+    void data(uint8_t value);
+
+    // Account an I2C transaction carrying length payload bytes
+    void transaction(size_t length, uint32_t clock);
+
+    // Account an SPI transfer of length bytes
+    void spiTransfer(size_t length, uint32_t clock);
+
+    void receive(uint8_t address, const uint8_t *data, size_t length, size_t dropped);
+
+    const uint8_t* getGDDRAM() const { return gddram; }
+    bool isDisplayOn() const { return on; }
+
+    // Compare the GDDRAM with a page-major buffer, returns the number of differing bytes
+    uint16_t compare(const uint8_t *buffer) const;
+
+    const SSD1306EmulatorStats& getStats() const { return stats; }
+    void resetStats(void);
+};
@@ -0,0 +1,41 @@
+/**
+ * Transport that feeds an SSD1306Emulator directly, without going
+ * through a bus library. Every call is accounted as one transfer on a
+ * 4-wire SPI bus running at the given clock.
+ */
+
+#pragma once
+
+#include "SSD1306Transport.h"
+#include "SSD1306Emulator.h"
+
+class SSD1306MockTransport : public SSD1306Transport {
+  private:
+    SSD1306Emulator    *emulator;
+    uint32_t            clock;
+    uint8_t             windowCost;
+    uint8_t             chunkSize;
+
+  public:
+    SSD1306MockTransport(SSD1306Emulator *emulator, uint32_t clock = 8000000, uint8_t windowCost = 6, uint8_t chunkSize = 64) {
+      this->emulator   = emulator;
+      this->clock      = clock;
+      this->windowCost = windowCost;
+      this->chunkSize  = chunkSize;
+    }
+
+    void begin(void) {}
+
+    void sendCommands(const uint8_t *commands, uint16_t length) {
+      emulator->spiTransfer(length, clock);
+      for (uint16_t i = 0; i < length; i++) emulator->command(commands[i]);
+    }
+
+    void sendData(const uint8_t *data, uint16_t length) {
+      emulator->spiTransfer(length, clock);
+      for (uint16_t i = 0; i < length; i++) emulator->data(data[i]);
+    }
+
+    uint8_t getWindowCost(void) { return windowCost; }
+    uint8_t getChunkSize(void) { return chunkSize; }
+};
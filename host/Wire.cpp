@@ -0,0 +1,53 @@
+#include "Wire.h"
+
+TwoWire Wire;
+
+void TwoWire::begin(int sda, int scl) {
+  begin();
+}
+
+void TwoWire::begin(void) {
+  transmitting = false;
+  txLength = 0;
+}
+
+void TwoWire::setClock(uint32_t frequency) {
+  clock = frequency;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  transmitting = true;
+  txAddress = address;
+  txLength = 0;
+  txDropped = 0;
+}
+
+uint8_t TwoWire::endTransmission(void) {
+  if (device) {
+    device->receive(txAddress, txBuffer, txLength, txDropped);
+  }
+  transmitting = false;
+  txLength = 0;
+  return txDropped ? 1 : 0; // 1: data too long to fit in transmit buffer
+}
+
+size_t TwoWire::write(uint8_t data) {
+  if (!transmitting) return 0;
+  if (txLength >= BUFFER_LENGTH) {
+    txDropped++;
+    return 0;
+  }
+  txBuffer[txLength++] = data;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t quantity) {
+  for (size_t i = 0; i < quantity; i++) {
+    if (!write(data[i])) return i;
+  }
+  return quantity;
+}
+
+void TwoWire::attach(TwoWireDevice *device) {
+  this->device = device;
+}
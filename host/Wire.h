@@ -0,0 +1,53 @@
+/**
+ * Recording stand-in for the ESP8266 Wire library.
+ *
+ * Every finished transmission is handed to the attached device (usually
+ * an SSD1306Emulator). Like the real library, writes beyond BUFFER_LENGTH
+ * are refused, so oversized transactions show up in the statistics.
+ */
+
+#pragma once
+
+#include "Arduino.h"
+
+#ifndef BUFFER_LENGTH
+#define BUFFER_LENGTH 32
+#endif
+
+class TwoWireDevice {
+  public:
+    virtual ~TwoWireDevice() {}
+
+    // Called once per transmission with the bytes following the address
+    virtual void receive(uint8_t address, const uint8_t *data, size_t length, size_t dropped) = 0;
+};
+
+class TwoWire {
+  private:
+    TwoWireDevice *device = NULL;
+
+    uint8_t        txAddress = 0;
+    uint8_t        txBuffer[BUFFER_LENGTH];
+    size_t         txLength  = 0;
+    size_t         txDropped = 0;
+    bool           transmitting = false;
+
+    uint32_t       clock = 100000;
+
+  public:
+    void begin(int sda, int scl);
+    void begin(void);
+    void setClock(uint32_t frequency);
+    uint32_t getClock(void) const { return clock; }
+
+    void beginTransmission(uint8_t address);
+    uint8_t endTransmission(void);
+
+    size_t write(uint8_t data);
+    size_t write(const uint8_t *data, size_t quantity);
+
+    // Host only: route transmissions to an emulated device
+    void attach(TwoWireDevice *device);
+};
+
+extern TwoWire Wire;
@@ -0,0 +1,236 @@
+/**
+ * Host side asset compiler for the icons.
+ *
+ * Converts images into the display's page order (see drawPageImage in
+ * lib/SSD1306/SSD1306.h) ahead of time, so the firmware blits them without
+ * reordering a single bit. The conversion is SSD1306::xbmToPages, the one
+ * drawXbm uses at runtime.
+ *
+ * Input are C headers with XBM arrays like src/icons.h (name_width,
+ * name_height and name_bits[]) and binary PGM files, where pixels brighter
+ * than half the maximum are set. The output header holds name_width,
+ * name_height and name_pages[] for every image:
+ *
+ *   make icons
+ *   host/build/assets -o src/iconPages.h src/icons.h logo.pgm
+ *
+ * Options:
+ *   -o FILE    header to write (default stdout)
+ */
+
+#include <regex>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+
+#include "SSD1306.h"
+
+// Bytes per line of the arrays, the same as in src/icons.h
+#define BYTES_PER_LINE 12
+
+struct Asset {
+  std::string          name;
+  std::string          source;
+  int16_t              width;
+  int16_t              height;
+  std::vector<uint8_t> pages;
+};
+
+// -/----- Input -----\-
+
+static bool readText(const char *fileName, std::string &text) {
+  FILE *file = fopen(fileName, "rb");
+  if (!file) return false;
+
+  char   chunk[4096];
+  size_t count;
+  while ((count = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    text.append(chunk, count);
+  }
+  fclose(file);
+  return true;
+}
+
+// Value of "#define name value" in text, -1 if there is none
+static long findDefine(const std::string &text, const std::string &name) {
+  std::smatch match;
+  if (!std::regex_search(text, match, std::regex("#define\\s+" + name + "\\s+(\\d+)"))) return -1;
+  return strtol(match[1].str().c_str(), NULL, 10);
+}
+
+static bool addAsset(std::vector<Asset> &assets, const std::string &name, const char *fileName,
+                     long width, long height, const std::vector<uint8_t> &xbm) {
+  if (width <= 0 || height <= 0 || width > 0x7FFF || height > 0x7FFF) {
+    fprintf(stderr, "%s: %s has no valid size\n", fileName, name.c_str());
+    return false;
+  }
+  if ((long) xbm.size() != (width + 7) / 8 * height) {
+    fprintf(stderr, "%s: %s has %u bytes, expected %ld\n", fileName, name.c_str(), (unsigned) xbm.size(), (width + 7) / 8 * height);
+    return false;
+  }
+
+  Asset asset;
+  asset.name   = name;
+  asset.source = fileName;
+  asset.width  = width;
+  asset.height = height;
+  asset.pages.resize(width * ((height + 7) / 8));
+  SSD1306::xbmToPages(width, height, (const char *) xbm.data(), asset.pages.data());
+  assets.push_back(asset);
+  return true;
+}
+
+// Every name_bits[] array of a C header
+static bool readXbms(const char *fileName, std::vector<Asset> &assets) {
+  std::string text;
+  if (!readText(fileName, text)) {
+    fprintf(stderr, "Could not read %s\n", fileName);
+    return false;
+  }
+
+  std::regex array("(?:static\\s+)?(?:const\\s+)?(?:unsigned\\s+)?char\\s+(\\w+)_bits\\s*\\[\\s*\\]\\s*(?:PROGMEM\\s*)?=\\s*\\{([^}]*)\\}");
+  std::regex byte("0[xX][0-9a-fA-F]+|\\d+");
+  uint16_t   found = 0;
+
+  for (std::sregex_iterator it(text.begin(), text.end(), array), end; it != end; ++it) {
+    std::string          name = (*it)[1].str();
+    std::string          data = (*it)[2].str();
+    std::vector<uint8_t> xbm;
+
+    for (std::sregex_iterator b(data.begin(), data.end(), byte); b != end; ++b) {
+      xbm.push_back(strtol(b->str().c_str(), NULL, 0));
+    }
+    if (!addAsset(assets, name, fileName, findDefine(text, name + "_width"), findDefine(text, name + "_height"), xbm)) return false;
+    found++;
+  }
+
+  if (!found) {
+    fprintf(stderr, "%s: no XBM arrays found\n", fileName);
+    return false;
+  }
+  return true;
+}
+
+// Skip whitespace and comments between the fields of a PGM header
+static int readPgmNumber(FILE *file) {
+  int c = fgetc(file);
+  while (c == '#' || isspace(c)) {
+    if (c == '#') {
+      while (c != '\n' && c != EOF) c = fgetc(file);
+    }
+    c = fgetc(file);
+  }
+  int value = 0;
+  while (isdigit(c)) {
+    value = value * 10 + c - '0';
+    c = fgetc(file);
+  }
+  return value;
+}
+
+// A binary PGM, named after the file without directory and extension
+static bool readPgm(const char *fileName, std::vector<Asset> &assets) {
+  FILE *file = fopen(fileName, "rb");
+  if (!file) {
+    fprintf(stderr, "Could not read %s\n", fileName);
+    return false;
+  }
+
+  int width = 0, height = 0, maxValue = 0;
+  if (fgetc(file) == 'P' && fgetc(file) == '5') {
+    width    = readPgmNumber(file);
+    height   = readPgmNumber(file);
+    maxValue = readPgmNumber(file);
+  }
+  if (width <= 0 || height <= 0 || maxValue <= 0 || maxValue > 255) {
+    fprintf(stderr, "%s is no 8 bit binary PGM\n", fileName);
+    fclose(file);
+    return false;
+  }
+
+  std::vector<uint8_t> pixels(width * height);
+  bool complete = fread(pixels.data(), 1, pixels.size(), file) == pixels.size();
+  fclose(file);
+  if (!complete) {
+    fprintf(stderr, "%s is too short\n", fileName);
+    return false;
+  }
+
+  // Rows of whole bytes, lowest bit leftmost
+  int16_t              widthInXbm = (width + 7) / 8;
+  std::vector<uint8_t> xbm(widthInXbm * height);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      if (pixels[x + y * width] * 2 > maxValue) xbm[x / 8 + y * widthInXbm] |= 1 << (x & 7);
+    }
+  }
+
+  std::string name = fileName;
+  size_t      slash = name.find_last_of('/');
+  if (slash != std::string::npos) name = name.substr(slash + 1);
+  name = name.substr(0, name.find('.'));
+  for (size_t i = 0; i < name.size(); i++) {
+    if (!isalnum((uint8_t) name[i])) name[i] = '_';
+  }
+  if (name.empty() || isdigit((uint8_t) name[0])) name = "image_" + name;
+
+  return addAsset(assets, name, fileName, width, height, xbm);
+}
+
+// -/----- Output -----\-
+
+static void writeHeader(FILE *out, const std::vector<Asset> &assets) {
+  fprintf(out, "// Generated by host/assets.cpp (make icons), do not edit.\n");
+  fprintf(out, "// Images in display page order, draw them with drawPageImage.\n");
+
+  for (size_t i = 0; i < assets.size(); i++) {
+    const Asset &asset = assets[i];
+    if (!i || asset.source != assets[i - 1].source) fprintf(out, "\n// From %s\n", asset.source.c_str());
+    fprintf(out, "\n#define %s_width %d\n", asset.name.c_str(), asset.width);
+    fprintf(out, "#define %s_height %d\n", asset.name.c_str(), asset.height);
+    fprintf(out, "const char %s_pages[] PROGMEM= {", asset.name.c_str());
+    for (size_t b = 0; b < asset.pages.size(); b++) {
+      fprintf(out, b % BYTES_PER_LINE ? " " : "\n  ");
+      fprintf(out, "0x%02X%s", asset.pages[b], b + 1 < asset.pages.size() ? "," : "");
+    }
+    fprintf(out, " };\n");
+  }
+}
+
+// -/----- Main -----\-
+
+int main(int argc, char **argv) {
+  std::vector<Asset> assets;
+  const char        *outName = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+      outName = argv[++i];
+    } else if (argv[i][0] == '-') {
+      fprintf(stderr, "Usage: %s [-o FILE] FILE...\n", argv[0]);
+      return 1;
+    } else {
+      const char *extension = strrchr(argv[i], '.');
+      bool        pgm       = extension && !strcmp(extension, ".pgm");
+      if (!(pgm ? readPgm(argv[i], assets) : readXbms(argv[i], assets))) return 1;
+    }
+  }
+
+  if (assets.empty()) {
+    fprintf(stderr, "No images\n");
+    return 1;
+  }
+
+  FILE *out = outName ? fopen(outName, "w") : stdout;
+  if (!out) {
+    fprintf(stderr, "Could not create %s\n", outName);
+    return 1;
+  }
+  writeHeader(out, assets);
+  if (outName) fclose(out);
+
+  if (outName) printf("%s, %u images\n", outName, (unsigned) assets.size());
+  return 0;
+}
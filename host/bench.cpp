@@ -0,0 +1,608 @@
+/**
+ * Host benchmark for the SSD1306 library.
+ *
+ * Runs the drawing primitives and a couple of typical frames against the
+ * emulated display and reports CPU time per operation as well as the I2C
+ * traffic per frame. Every frame is checked against the emulated GDDRAM,
+ * the exit code is non zero if the display content ever diverges.
+ *
+ *   make bench
+ */
+
+#include <chrono>
+#include <stdio.h>
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include "SSD1306.h"
+#include "SSD1306Ui.h"
+#include "SSD1306Emulator.h"
+#include "SSD1306MockTransport.h"
+
+#include "../src/icons.h"
+#include "../src/iconPages.h"
+
+#define DISPLAY_ADDRESS 0x3C
+
+SSD1306         display(DISPLAY_ADDRESS, 4, 5);
+SSD1306Emulator emulator(DISPLAY_ADDRESS);
+
+// Same display on an 8 MHz SPI bus
+SSD1306Emulator      spiEmulator;
+SSD1306MockTransport spiTransport(&spiEmulator, 8000000);
+SSD1306              spiDisplay(&spiTransport);
+
+uint32_t        failures = 0;
+
+static uint32_t randomState = 0x12345678;
+
+static uint32_t nextRandom() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+static double nowNanos() {
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// -/----- Primitives -----\-
+
+template <typename F>
+static void benchPrimitive(const char *name, uint32_t iterations, F operation) {
+  display.clear();
+  double start = nowNanos();
+  for (uint32_t i = 0; i < iterations; i++) {
+    operation(i);
+  }
+  double elapsed = nowNanos() - start;
+  printf("  %-28s %10.1f ns/op\n", name, elapsed / iterations);
+}
+
+static char noiseImage[DISPLAY_BUFFER_SIZE];
+static char noisePages[DISPLAY_BUFFER_SIZE];
+
+// noiseImage reordered from columns into pages
+static void transposeNoise() {
+  for (uint8_t page = 0; page < DISPLAY_PAGES; page++) {
+    for (uint8_t x = 0; x < DISPLAY_WIDTH; x++) {
+      noisePages[x + page * DISPLAY_WIDTH] = noiseImage[x * DISPLAY_PAGES + page];
+    }
+  }
+}
+
+static void benchPrimitives() {
+  for (uint16_t i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
+    noiseImage[i] = nextRandom();
+  }
+  transposeNoise();
+
+  printf("Primitives\n");
+  display.setColor(WHITE);
+  display.setFont(ArialMT_Plain_16);
+  display.setTextAlignment(TEXT_ALIGN_LEFT);
+
+  benchPrimitive("setPixel", 1000000, [](uint32_t i) {
+    display.setPixel(i & 127, (i >> 7) & 63);
+  });
+  benchPrimitive("drawHorizontalLine 100", 100000, [](uint32_t i) {
+    display.drawHorizontalLine(i & 31, i & 63, 100);
+  });
+  benchPrimitive("drawVerticalLine 50", 100000, [](uint32_t i) {
+    display.drawVerticalLine(i & 127, i & 7, 50);
+  });
+  benchPrimitive("drawLine 127x63", 100000, [](uint32_t i) {
+    display.drawLine(0, 0, 127, 63);
+  });
+  benchPrimitive("drawRect 60x30", 100000, [](uint32_t i) {
+    display.drawRect(i & 31, i & 31, 60, 30);
+  });
+  benchPrimitive("fillRect 60x30", 20000, [](uint32_t i) {
+    display.fillRect(i & 31, i & 31, 60, 30);
+  });
+  benchPrimitive("fillRect 120x5 (progress)", 50000, [](uint32_t i) {
+    display.fillRect(6, 34, 120, 5);
+  });
+  benchPrimitive("drawFastImage 128x64", 5000, [](uint32_t i) {
+    display.drawFastImage(0, 0, 128, 64, noiseImage);
+  });
+  benchPrimitive("drawFastImage 128x64 y+3", 5000, [](uint32_t i) {
+    display.drawFastImage(0, 3, 128, 64, noiseImage);
+  });
+  benchPrimitive("drawFastImage 8x8 (indicator)", 200000, [](uint32_t i) {
+    display.drawFastImage(40 + (i & 3) * 12, 56, 8, 8, noiseImage);
+  });
+  benchPrimitive("drawPageImage 128x64", 5000, [](uint32_t i) {
+    display.drawPageImage(0, 0, 128, 64, noisePages);
+  });
+  benchPrimitive("drawPageImage 128x64 y+3", 5000, [](uint32_t i) {
+    display.drawPageImage(0, 3, 128, 64, noisePages);
+  });
+  benchPrimitive("copyPageImage 24x10 y+3", 100000, [](uint32_t i) {
+    display.copyPageImage(i & 63, 3, 24, 10, noisePages);
+  });
+  benchPrimitive("drawXbm 60x60", 5000, [](uint32_t i) {
+    display.drawXbm(0, 0, 60, 60, berlin_bits);
+  });
+  benchPrimitive("drawPageImage 60x60 icon", 5000, [](uint32_t i) {
+    display.drawPageImage(0, 0, 60, 60, berlin_pages);
+  });
+  benchPrimitive("drawString 16px \"12:34:56\"", 20000, [](uint32_t i) {
+    display.drawString(60, 24, "12:34:56");
+  });
+  benchPrimitive("clear", 100000, [](uint32_t i) {
+    display.clear();
+  });
+  printf("\n");
+}
+
+// -/----- Consistency -----\-
+
+// The same image in column and in page order has to look the same
+static void checkImageFunctions() {
+  static const int16_t offsets[][2] = { {0, 0}, {5, 3}, {-7, 0}, {3, 13}, {-20, 8}, {100, 60} };
+  uint8_t expected[DISPLAY_BUFFER_SIZE];
+
+  for (uint8_t i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++) {
+    int16_t x = offsets[i][0];
+    int16_t y = offsets[i][1];
+
+    display.clear();
+    display.drawFastImage(x, y, 128, 64, noiseImage);
+    memcpy(expected, display.getBuffer(), DISPLAY_BUFFER_SIZE);
+
+    display.clear();
+    display.drawPageImage(x, y, 128, 64, noisePages);
+    if (memcmp(expected, display.getBuffer(), DISPLAY_BUFFER_SIZE) != 0) {
+      printf("drawPageImage(%d, %d) differs from drawFastImage\n", x, y);
+      failures++;
+    }
+  }
+}
+
+// Draws the same on the noise background once with setPixel (reference)
+// and once with the primitive under test, both have to set the same pixels
+template <typename R, typename P>
+static void checkSame(const char *label, SSD1306_COLOR color, R reference, P primitive) {
+  uint8_t expected[DISPLAY_BUFFER_SIZE];
+
+  display.clear();
+  display.setColor(WHITE);
+  display.drawPageImage(0, 0, 128, 64, noisePages);
+  display.setColor(color);
+  reference();
+  memcpy(expected, display.getBuffer(), DISPLAY_BUFFER_SIZE);
+
+  display.clear();
+  display.setColor(WHITE);
+  display.drawPageImage(0, 0, 128, 64, noisePages);
+  display.setColor(color);
+  primitive();
+  if (memcmp(expected, display.getBuffer(), DISPLAY_BUFFER_SIZE) != 0) {
+    printf("%s differs from setPixel\n", label);
+    failures++;
+  }
+  display.setColor(WHITE);
+}
+
+// drawFastImage takes a shortcut for images on page boundaries, it has to
+// set the same pixels as setPixel
+static void checkFastImage() {
+  static const int16_t rects[][4] = { {0, 0, 128, 64}, {5, 8, 24, 16}, {1, 16, 13, 24}, {100, 56, 28, 8}, {7, 8, 3, 8} };
+  static const SSD1306_COLOR colors[] = { WHITE, BLACK, INVERSE };
+  char label[64];
+
+  for (uint8_t c = 0; c < 3; c++) {
+    for (uint8_t i = 0; i < sizeof(rects) / sizeof(rects[0]); i++) {
+      int16_t x      = rects[i][0];
+      int16_t y      = rects[i][1];
+      int16_t width  = rects[i][2];
+      int16_t height = rects[i][3];
+      uint8_t raster = (height + 7) / 8;
+
+      snprintf(label, sizeof(label), "drawFastImage(%d, %d, %d, %d) in color %d", x, y, width, height, colors[c]);
+      checkSame(label, colors[c], [&]() {
+        for (int16_t dx = 0; dx < width; dx++) {
+          for (int16_t dy = 0; dy < height; dy++) {
+            if (noiseImage[dx * raster + (dy >> 3)] & (1 << (dy & 7))) display.setPixel(x + dx, y + dy);
+          }
+        }
+      }, [&]() {
+        display.drawFastImage(x, y, width, height, noiseImage);
+      });
+    }
+  }
+}
+
+// Canvas buffers do not have to be word aligned, the word loops of
+// drawFastImage and drawPageImage have to give the same result as on the
+// display's buffer
+static void checkUnalignedCanvas() {
+  static const int16_t rects[][4] = { {0, 0, 128, 64}, {5, 8, 24, 16}, {1, 16, 13, 24}, {3, 0, 61, 64} };
+  static const SSD1306_COLOR colors[] = { WHITE, BLACK, INVERSE };
+  static uint32_t storage[DISPLAY_BUFFER_SIZE / 4 + 1];
+
+  for (uint8_t offset = 1; offset < 4; offset++) {
+    SSD1306 canvas((uint8_t *) storage + offset);
+    for (uint8_t c = 0; c < 3; c++) {
+      for (uint8_t i = 0; i < sizeof(rects) / sizeof(rects[0]); i++) {
+        for (uint8_t pages = 0; pages < 2; pages++) {
+          int16_t  x         = rects[i][0];
+          int16_t  y         = rects[i][1];
+          int16_t  width     = rects[i][2];
+          int16_t  height    = rects[i][3];
+          SSD1306 *targets[] = { &display, &canvas };
+
+          for (uint8_t t = 0; t < 2; t++) {
+            SSD1306 *target = targets[t];
+            target->clear();
+            target->setColor(WHITE);
+            target->drawPageImage(0, 0, 128, 64, noisePages);
+            target->setColor(colors[c]);
+            if (pages) {
+              target->drawPageImage(x, y, width, height, noiseImage);
+            } else {
+              target->drawFastImage(x, y, width, height, noiseImage);
+            }
+          }
+          if (memcmp(display.getBuffer(), canvas.getBuffer(), DISPLAY_BUFFER_SIZE) != 0) {
+            printf("%s(%d, %d, %d, %d) in color %d differs on a buffer at offset %d\n",
+                   pages ? "drawPageImage" : "drawFastImage", x, y, width, height, colors[c], offset);
+            failures++;
+          }
+        }
+      }
+    }
+  }
+  display.setColor(WHITE);
+}
+
+// drawVerticalLine writes partial bytes at both ends, it has to set the
+// same pixels as setPixel in every color
+static void checkVerticalLine() {
+  static const int16_t lines[][3] = { {0, 0, 64}, {5, 3, 2}, {6, 3, 13}, {7, 8, 8}, {8, -4, 9}, {127, 60, 10} };
+  static const SSD1306_COLOR colors[] = { WHITE, BLACK, INVERSE };
+  char label[64];
+
+  for (uint8_t c = 0; c < 3; c++) {
+    for (uint8_t i = 0; i < sizeof(lines) / sizeof(lines[0]); i++) {
+      int16_t x      = lines[i][0];
+      int16_t y      = lines[i][1];
+      int16_t length = lines[i][2];
+
+      snprintf(label, sizeof(label), "drawVerticalLine(%d, %d, %d) in color %d", x, y, length, colors[c]);
+      checkSame(label, colors[c], [&]() {
+        for (int16_t dy = 0; dy < length; dy++) display.setPixel(x, y + dy);
+      }, [&]() {
+        display.drawVerticalLine(x, y, length);
+      });
+    }
+  }
+}
+
+// copyPageImage has to replace exactly the pixels of the rectangle
+static void checkCopyPageImage() {
+  static const int16_t rects[][4] = { {0, 0, 128, 64}, {5, 3, 24, 10}, {-7, 13, 20, 8}, {120, 60, 16, 9}, {30, -5, 9, 17} };
+  char label[64];
+
+  for (uint8_t i = 0; i < sizeof(rects) / sizeof(rects[0]); i++) {
+    int16_t x      = rects[i][0];
+    int16_t y      = rects[i][1];
+    int16_t width  = rects[i][2];
+    int16_t height = rects[i][3];
+
+    snprintf(label, sizeof(label), "copyPageImage(%d, %d, %d, %d)", x, y, width, height);
+    checkSame(label, WHITE, [&]() {
+      for (int16_t dy = 0; dy < height; dy++) {
+        for (int16_t dx = 0; dx < width; dx++) {
+          bool on = noiseImage[dx + (dy >> 3) * width] & (1 << (dy & 7));
+          display.setColor(on ? WHITE : BLACK);
+          display.setPixel(x + dx, y + dy);
+        }
+      }
+    }, [&]() {
+      display.copyPageImage(x, y, width, height, noiseImage);
+    });
+  }
+}
+
+// drawXbm converts the XBM into page order, it has to set the same
+// pixels as setPixel
+static void checkXbm() {
+  static const int16_t rects[][4] = { {0, 0, 60, 60}, {34, 4, 60, 60}, {-5, -3, 13, 11}, {120, 58, 13, 11}, {7, 8, 8, 8}, {3, 21, 1, 1} };
+  static const SSD1306_COLOR colors[] = { WHITE, BLACK, INVERSE };
+  char label[64];
+
+  for (uint8_t c = 0; c < 3; c++) {
+    for (uint8_t i = 0; i < sizeof(rects) / sizeof(rects[0]); i++) {
+      int16_t     x          = rects[i][0];
+      int16_t     y          = rects[i][1];
+      int16_t     width      = rects[i][2];
+      int16_t     height     = rects[i][3];
+      int16_t     widthInXbm = (width + 7) / 8;
+      const char *xbm        = i == 0 ? berlin_bits : noiseImage + i;
+
+      snprintf(label, sizeof(label), "drawXbm(%d, %d, %d, %d) in color %d", x, y, width, height, colors[c]);
+      checkSame(label, colors[c], [&]() {
+        for (int16_t dy = 0; dy < height; dy++) {
+          for (int16_t dx = 0; dx < width; dx++) {
+            if (xbm[dx / 8 + dy * widthInXbm] & (1 << (dx & 7))) display.setPixel(x + dx, y + dy);
+          }
+        }
+      }, [&]() {
+        display.drawXbm(x, y, width, height, xbm);
+      });
+    }
+  }
+}
+
+// drawXbm must not keep anything of an image, the same buffer drawn
+// again with other content shows the new content
+static void checkChangedXbm() {
+  static char xbm[2 * 11];
+  uint8_t expected[DISPLAY_BUFFER_SIZE];
+
+  memcpy(xbm, noiseImage, sizeof(xbm));
+  display.clear();
+  display.drawXbm(5, 3, 13, 11, xbm);
+
+  memcpy(xbm, noiseImage + 100, sizeof(xbm));
+  display.clear();
+  display.drawXbm(5, 3, 13, 11, noiseImage + 100);
+  memcpy(expected, display.getBuffer(), DISPLAY_BUFFER_SIZE);
+
+  display.clear();
+  display.drawXbm(5, 3, 13, 11, xbm);
+  if (memcmp(expected, display.getBuffer(), DISPLAY_BUFFER_SIZE) != 0) {
+    printf("drawXbm shows the old content of a changed XBM\n");
+    failures++;
+  }
+}
+
+// src/iconPages.h has to be regenerated (make icons) when src/icons.h changes
+static void checkIconPages() {
+  #define ICON(name) { #name, name##_bits, name##_pages }
+  static const struct { const char *name; const char *xbm; const char *pages; } icons[] = {
+    ICON(amsterdam), ICON(austin), ICON(barcelona), ICON(berlin), ICON(cape_town),
+    ICON(dublin), ICON(london), ICON(new_york), ICON(paris), ICON(san_francisco),
+    ICON(stockholm), ICON(sydney), ICON(tokyo), ICON(wellington)
+  };
+  #undef ICON
+  uint8_t pages[60 * 8];
+
+  for (uint8_t i = 0; i < sizeof(icons) / sizeof(icons[0]); i++) {
+    SSD1306::xbmToPages(60, 60, icons[i].xbm, pages);
+    if (memcmp(pages, icons[i].pages, sizeof(pages)) != 0) {
+      printf("%s_pages differs from %s_bits, run make icons\n", icons[i].name, icons[i].name);
+      failures++;
+    }
+  }
+}
+
+// -/----- Frames -----\-
+
+static String twoDigits(uint32_t value) {
+  return value < 10 ? "0" + String(value) : String(value);
+}
+
+static void drawClock(SSD1306 *display, int16_t x, int16_t y, uint32_t seconds, String city, const char *icon) {
+  display->setTextAlignment(TEXT_ALIGN_LEFT);
+  display->setFont(ArialMT_Plain_10);
+  display->drawString(x + 60, y + 5, city);
+  display->drawPageImage(x, y, 60, 60, icon);
+  display->setFont(ArialMT_Plain_16);
+  display->drawString(x + 60, y + 24, twoDigits(seconds / 3600 % 24) + ":" + twoDigits(seconds / 60 % 60) + ":" + twoDigits(seconds % 60));
+}
+
+static void drawIndicator(SSD1306 *display, uint8_t active) {
+  for (uint8_t i = 0; i < 4; i++) {
+    display->drawFastImage(40 + 12 * i, 56, 8, 8, i == active ? ANIMATION_activeSymbol : ANIMATION_inactiveSymbol);
+  }
+}
+
+struct Scene {
+  const char *name;
+  void (*draw)(SSD1306 *display, uint32_t frame);
+  // Frames replace the whole buffer, no clear() before drawing
+  bool streamed;
+};
+
+Scene scenes[] = {
+  { "blank", [](SSD1306 *display, uint32_t frame) {} },
+  { "static clock", [](SSD1306 *display, uint32_t frame) {
+      drawClock(display, 0, 0, 45296, "Berlin", berlin_pages);
+      drawIndicator(display, 1);
+  } },
+  { "ticking clock", [](SSD1306 *display, uint32_t frame) {
+      drawClock(display, 0, 0, 45296 + frame, "Berlin", berlin_pages);
+      drawIndicator(display, 1);
+  } },
+  { "clock+indicator", [](SSD1306 *display, uint32_t frame) {
+      // Changes at the top and the bottom of the screen
+      display->setFont(ArialMT_Plain_10);
+      display->setTextAlignment(TEXT_ALIGN_LEFT);
+      display->drawString(0, 0, twoDigits(frame % 60));
+      drawIndicator(display, frame % 4);
+  } },
+  { "sliding clocks", [](SSD1306 *display, uint32_t frame) {
+      int16_t x = -(int16_t) ((frame * 8) & 127);
+      drawClock(display, x, 0, 45296, "Berlin", berlin_pages);
+      drawClock(display, x + 128, 0, 45296, "London", london_pages);
+  } },
+  { "video (noise)", [](SSD1306 *display, uint32_t frame) {
+      for (uint16_t i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
+        noiseImage[i] = nextRandom();
+      }
+      display->drawFastImage(0, 0, 128, 64, noiseImage);
+  } },
+  { "video (stream)", [](SSD1306 *display, uint32_t frame) {
+      for (uint16_t i = 0; i < DISPLAY_BUFFER_SIZE; i++) {
+        noisePages[i] = nextRandom();
+      }
+      display->displayFrame((const uint8_t *) noisePages);
+  }, true },
+};
+
+static void benchScene(SSD1306 &display, SSD1306Emulator &emulator, Scene &scene, uint32_t frames) {
+  double drawNanos = 0;
+  double displayNanos = 0;
+  uint32_t mismatches = 0;
+
+  // Start every scene from a known state
+  display.clear();
+  display.display();
+  emulator.resetStats();
+
+  for (uint32_t frame = 0; frame < frames; frame++) {
+    double start = nowNanos();
+    if (!scene.streamed) display.clear();
+    scene.draw(&display, frame);
+    double drawn = nowNanos();
+    display.display();
+    displayNanos += nowNanos() - drawn;
+    drawNanos += drawn - start;
+
+    if (emulator.compare(display.getBuffer()) != 0) {
+      mismatches++;
+    }
+  }
+
+  const SSD1306EmulatorStats &stats = emulator.getStats();
+  printf("  %-16s %8.1f %8.1f %9.1f %7.1f %9.1f %5u\n",
+    scene.name,
+    drawNanos / frames / 1000,
+    displayNanos / frames / 1000,
+    (double) stats.wireBytes / frames,
+    (double) stats.transactions / frames,
+    stats.busMicros / frames,
+    mismatches);
+
+  if (stats.droppedBytes) {
+    printf("  %-16s dropped %u bytes exceeding the Wire buffer\n", scene.name, stats.droppedBytes);
+    failures++;
+  }
+  failures += mismatches;
+}
+
+static void benchFrames(SSD1306 &display, SSD1306Emulator &emulator, const char *bus) {
+  printf("Frames on %s (per frame)\n", bus);
+  printf("  %-16s %8s %8s %9s %7s %9s %5s\n", "scene", "draw us", "disp us", "wire B", "trans", "bus us", "bad");
+  for (uint8_t i = 0; i < sizeof(scenes) / sizeof(Scene); i++) {
+    benchScene(display, emulator, scenes[i], 200);
+  }
+  printf("\n");
+}
+
+// -/----- UI -----\-
+
+static void berlinFrame(SSD1306 *display, SSD1306UiState* state, int16_t x, int16_t y) {
+  drawClock(display, x, y, 45296 + millis() / 1000, "Berlin", berlin_pages);
+}
+
+static void londonFrame(SSD1306 *display, SSD1306UiState* state, int16_t x, int16_t y) {
+  drawClock(display, x, y, 41696 + millis() / 1000, "London", london_pages);
+}
+
+static void benchUi(bool async) {
+  FrameCallback frames[] = { berlinFrame, londonFrame };
+  SSD1306Ui ui(&display);
+
+  ui.setTargetFPS(60);
+  ui.setFrames(frames, 2);
+  ui.setTimePerFrame(2000);
+  ui.setTimePerTransition(500);
+
+  display.setAsyncFlush(async);
+  emulator.resetStats();
+
+  uint32_t ticks = 0;
+  uint32_t mismatches = 0;
+  unsigned long longestUpdate = 0;
+  unsigned long startMillis = millis();
+  double start = nowNanos();
+
+  // Ten seconds of virtual time, same loop as in main.cpp
+  while (millis() - startMillis < 10000) {
+    unsigned long updateStart = micros();
+    int timeBudget = ui.update();
+    longestUpdate = max(longestUpdate, micros() - updateStart);
+
+    if (timeBudget <= 0) {
+      ticks++;
+      if (!async && emulator.compare(display.getBuffer()) != 0) {
+        mismatches++;
+      }
+    }
+
+    unsigned long ms = millis();
+    int remainingBudget = timeBudget;
+
+    if (async) {
+      bool pending = display.flushStep(remainingBudget > 0 ? remainingBudget * 1000 : 0);
+      if (!pending && emulator.compare(display.getBuffer()) != 0) {
+        mismatches++;
+      }
+      remainingBudget = timeBudget - (millis() - ms);
+    }
+
+    if (remainingBudget > 0) {
+      delay(remainingBudget);
+    }
+  }
+
+  display.flush();
+  display.setAsyncFlush(false);
+
+  double elapsed = nowNanos() - start;
+  const SSD1306EmulatorStats &stats = emulator.getStats();
+  printf("SSD1306Ui, 10 s virtual time, 60 FPS target, %s flush\n", async ? "async" : "blocking");
+  printf("  ticks            %u (%.1f FPS)\n", ticks, ticks / 10.0);
+  printf("  cpu per tick     %.1f us\n", elapsed / ticks / 1000);
+  printf("  wire per tick    %.1f bytes, %.1f transactions\n", (double) stats.wireBytes / ticks, (double) stats.transactions / ticks);
+  printf("  bus per tick     %.1f us\n", stats.busMicros / ticks);
+  printf("  longest update() %lu us\n", longestUpdate);
+  printf("  bad frames       %u\n\n", mismatches);
+
+  failures += mismatches;
+}
+
+int main() {
+  emulator.attach(Wire);
+
+  if (!display.init()) {
+    printf("Could not initialize display\n");
+    return 1;
+  }
+
+  if (!emulator.isDisplayOn() || emulator.compare(display.getBuffer()) != 0) {
+    printf("Display was not initialized correctly\n");
+    failures++;
+  }
+
+  benchPrimitives();
+  checkImageFunctions();
+  checkFastImage();
+  checkCopyPageImage();
+  checkVerticalLine();
+  checkUnalignedCanvas();
+  checkXbm();
+  checkChangedXbm();
+  checkIconPages();
+  benchFrames(display, emulator, "700 kHz I2C");
+
+  if (!spiDisplay.init()) {
+    printf("Could not initialize SPI display\n");
+    return 1;
+  }
+  benchFrames(spiDisplay, spiEmulator, "8 MHz SPI");
+  benchUi(false);
+  benchUi(true);
+
+  if (failures) {
+    printf("FAILED: %u frames did not match the emulated display\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,411 @@
+/**
+ * Host side video encoder for the web frame.
+ *
+ * Does the work the browser does for every video frame (scale, dither,
+ * pack into display pages, delta or PackBits compress, see srcweb/main.js)
+ * ahead of time and writes the resulting messages into a stream file,
+ * which the web page replays without encoding anything. Every message is
+ * decoded again and compared with the frame, the exit code is non zero if
+ * they ever differ.
+ *
+ * Input is 8 bit grayscale, binary PGM files or raw frames:
+ *
+ *   make encoder
+ *   ffmpeg -i video.mp4 -f rawvideo -pix_fmt gray - | host/build/encoder -raw 320x240 -o video.oled
+ *   host/build/encoder -fs -o images.oled *.pgm
+ *
+ * Options:
+ *   -raw WxH   read raw frames of that size from the files or stdin
+ *   -fs        Floyd-Steinberg instead of ordered dithering
+ *   -fps N     frame rate stored for the replay (default 30)
+ *   -o FILE    stream file to write (default stream.oled)
+ */
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <Arduino.h>
+
+#include "SSD1306.h"
+
+#include "../src/FrameCodec.h"
+
+// Stream file: "OLED", version and frames per second (one byte each),
+// then every message as its length (uint16 LE) followed by the message
+// as it is sent over the WebSocket
+#define STREAM_VERSION   1
+
+// Binary message types, see src/WebSocket.h
+#define MSG_FRAME_STREAM 0x02
+#define MSG_STREAM_DELTA 0x04
+#define MSG_STREAM_RLE   0x06
+
+// Send a full frame at least this often, like the browser does
+#define KEYFRAME_INTERVAL 60
+
+uint32_t failures = 0;
+
+static double nowNanos() {
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// -/----- Input -----\-
+
+struct Source {
+  std::vector<const char *> files;
+  size_t   nextFile = 0;
+  FILE    *file     = NULL;
+  bool     raw      = false;
+  uint16_t width    = 0;
+  uint16_t height   = 0;
+};
+
+// Skip whitespace and comments between the fields of a PGM header
+static int readPgmNumber(FILE *file) {
+  int c = fgetc(file);
+  while (c == '#' || c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+    if (c == '#') {
+      while (c != '\n' && c != EOF) c = fgetc(file);
+    }
+    c = fgetc(file);
+  }
+
+  int value = -1;
+  while (c >= '0' && c <= '9') {
+    value = (value < 0 ? 0 : value * 10) + (c - '0');
+    c = fgetc(file);
+  }
+  return value;
+}
+
+// Read the next frame into pixels, returns false at the end of the input
+static bool readFrame(Source &source, std::vector<uint8_t> &pixels) {
+  while (true) {
+    if (!source.file) {
+      if (source.nextFile >= source.files.size()) {
+        // Raw frames without files come from stdin
+        if (!source.files.empty() || !source.raw || source.nextFile > 0) return false;
+        source.file = stdin;
+        source.nextFile++;
+      } else {
+        const char *name = source.files[source.nextFile++];
+        source.file = fopen(name, "rb");
+        if (!source.file) {
+          fprintf(stderr, "Could not open %s\n", name);
+          failures++;
+          continue;
+        }
+      }
+    }
+
+    if (!source.raw) {
+      if (fgetc(source.file) != 'P' || fgetc(source.file) != '5') {
+        fprintf(stderr, "Only binary PGM files (P5) are supported\n");
+        failures++;
+        fclose(source.file);
+        source.file = NULL;
+        continue;
+      }
+      int width  = readPgmNumber(source.file);
+      int height = readPgmNumber(source.file);
+      int maxval = readPgmNumber(source.file);
+      if (width <= 0 || height <= 0 || maxval <= 0 || maxval > 255) {
+        fprintf(stderr, "Only 8 bit PGM files are supported\n");
+        failures++;
+        fclose(source.file);
+        source.file = NULL;
+        continue;
+      }
+      source.width  = width;
+      source.height = height;
+    }
+
+    pixels.resize(source.width * source.height);
+    bool complete = fread(pixels.data(), 1, pixels.size(), source.file) == pixels.size();
+
+    // A PGM file holds one frame, raw files as many as fit
+    if (!complete || !source.raw) {
+      if (source.file != stdin) fclose(source.file);
+      source.file = NULL;
+    }
+    if (complete) return true;
+  }
+}
+
+// -/----- Frames -----\-
+
+// Average the source pixels covered by every display pixel, the image is
+// stretched to the display like the browser's canvas does
+static void scale(const Source &source, const uint8_t *pixels, uint8_t *gray) {
+  for (uint8_t y = 0; y < DISPLAY_HEIGHT; y++) {
+    uint32_t y0 = y * source.height / DISPLAY_HEIGHT;
+    uint32_t y1 = max((uint32_t) (y + 1) * source.height / DISPLAY_HEIGHT, y0 + 1);
+
+    for (uint8_t x = 0; x < DISPLAY_WIDTH; x++) {
+      uint32_t x0 = x * source.width / DISPLAY_WIDTH;
+      uint32_t x1 = max((uint32_t) (x + 1) * source.width / DISPLAY_WIDTH, x0 + 1);
+
+      uint32_t sum = 0;
+      for (uint32_t sy = y0; sy < y1; sy++) {
+        const uint8_t *row = pixels + sy * source.width;
+        for (uint32_t sx = x0; sx < x1; sx++) {
+          sum += row[sx];
+        }
+      }
+      gray[x + y * DISPLAY_WIDTH] = sum / ((y1 - y0) * (x1 - x0));
+    }
+  }
+}
+
+// Pixels brighter than the threshold at their position are set. The
+// thresholds repeat every page (8 rows).
+static uint8_t ditherThresholds[8 * DISPLAY_WIDTH];
+
+static void orderedThresholds() {
+  static const uint8_t bayer[8][8] = {
+    {  0, 32,  8, 40,  2, 34, 10, 42 },
+    { 48, 16, 56, 24, 50, 18, 58, 26 },
+    { 12, 44,  4, 36, 14, 46,  6, 38 },
+    { 60, 28, 52, 20, 62, 30, 54, 22 },
+    {  3, 35, 11, 43,  1, 33,  9, 41 },
+    { 51, 19, 59, 27, 49, 17, 57, 25 },
+    { 15, 47,  7, 39, 13, 45,  5, 37 },
+    { 63, 31, 55, 23, 61, 29, 53, 21 }
+  };
+  for (uint8_t y = 0; y < 8; y++) {
+    for (uint8_t x = 0; x < DISPLAY_WIDTH; x++) {
+      ditherThresholds[x + y * DISPLAY_WIDTH] = bayer[y][x & 7] * 4 + 2;
+    }
+  }
+}
+
+// Floyd-Steinberg leaves only black and white, which are split in the middle
+static void fixedThresholds() {
+  memset(ditherThresholds, 127, sizeof(ditherThresholds));
+}
+
+static void floydSteinberg(uint8_t *gray) {
+  static int16_t error[2][DISPLAY_WIDTH + 2];
+  memset(error, 0, sizeof(error));
+
+  for (uint8_t y = 0; y < DISPLAY_HEIGHT; y++) {
+    int16_t *current = error[y & 1];
+    int16_t *next    = error[(y + 1) & 1];
+    memset(next, 0, sizeof(error[0]));
+
+    for (uint8_t x = 0; x < DISPLAY_WIDTH; x++) {
+      int16_t value = gray[x + y * DISPLAY_WIDTH] + current[x + 1] / 16;
+      uint8_t out   = value > 127 ? 255 : 0;
+      int16_t diff  = value - out;
+
+      gray[x + y * DISPLAY_WIDTH] = out;
+      current[x + 2] += diff * 7;
+      next[x]        += diff * 3;
+      next[x + 1]    += diff * 5;
+      next[x + 2]    += diff;
+    }
+  }
+}
+
+// Bits of 16 neighbouring pixels of a row that are above their threshold
+static inline uint16_t rowBits(const uint8_t *pixels, const uint8_t *thresholds) {
+#ifdef __SSE2__
+  // There is no unsigned byte compare, move both into the signed range
+  const __m128i bias = _mm_set1_epi8((char) 0x80);
+  __m128i p = _mm_xor_si128(_mm_loadu_si128((const __m128i *) pixels), bias);
+  __m128i t = _mm_xor_si128(_mm_loadu_si128((const __m128i *) thresholds), bias);
+  return _mm_movemask_epi8(_mm_cmpgt_epi8(p, t));
+#else
+  uint16_t bits = 0;
+  for (uint8_t i = 0; i < 16; i++) {
+    if (pixels[i] > thresholds[i]) bits |= 1 << i;
+  }
+  return bits;
+#endif
+}
+
+// Threshold the pixels and pack them into display pages, one byte holds
+// 8 vertical pixels. Works on 16 columns of a page at a time.
+static void pack(const uint8_t *gray, uint8_t *frame) {
+  for (uint8_t page = 0; page < DISPLAY_PAGES; page++) {
+    for (uint8_t x = 0; x < DISPLAY_WIDTH; x += 16) {
+      uint16_t rows[8];
+      for (uint8_t r = 0; r < 8; r++) {
+        rows[r] = rowBits(gray + x + (page * 8 + r) * DISPLAY_WIDTH, ditherThresholds + x + r * DISPLAY_WIDTH);
+      }
+
+      uint8_t *out = frame + x + page * DISPLAY_WIDTH;
+      for (uint8_t i = 0; i < 16; i++) {
+        uint8_t column = 0;
+        for (uint8_t r = 0; r < 8; r++) {
+          column |= ((rows[r] >> i) & 1) << r;
+        }
+        out[i] = column;
+      }
+    }
+  }
+}
+
+// -/----- Messages -----\-
+
+// Pick the smallest message for frame, the same choice as sendFrame() in
+// srcweb/main.js. Returns the message length.
+static uint16_t encodeFrame(const uint8_t *previous, const uint8_t *frame, uint32_t &framesSinceKey, uint8_t *message) {
+  // Encoded messages have to stay shorter than an old style frame
+  int16_t  maxLength = DISPLAY_BUFFER_SIZE - 2;
+  uint16_t length    = DISPLAY_BUFFER_SIZE;
+
+  message[0] = MSG_FRAME_STREAM;
+  memcpy(message + 1, frame, DISPLAY_BUFFER_SIZE);
+
+  static uint8_t encoded[DISPLAY_BUFFER_SIZE];
+  if (previous && ++framesSinceKey < KEYFRAME_INTERVAL) {
+    int16_t delta = encodeDelta(previous, frame, encoded, maxLength);
+    if (delta >= 0) {
+      message[0] = MSG_STREAM_DELTA;
+      memcpy(message + 1, encoded, delta);
+      length    = delta;
+      maxLength = delta - 1;
+    }
+  }
+
+  int16_t packed = maxLength > 0 ? encodePackBits(frame, encoded, maxLength) : -1;
+  if (packed >= 0) {
+    message[0] = MSG_STREAM_RLE;
+    memcpy(message + 1, encoded, packed);
+    length = packed;
+  }
+
+  if (message[0] != MSG_STREAM_DELTA) framesSinceKey = 0;
+  return 1 + length;
+}
+
+// Apply the message like the device does
+static bool decodeMessage(const uint8_t *message, uint16_t length, uint8_t *frame) {
+  switch (message[0]) {
+    case MSG_FRAME_STREAM:
+      memcpy(frame, message + 1, DISPLAY_BUFFER_SIZE);
+      return length == 1 + DISPLAY_BUFFER_SIZE;
+    case MSG_STREAM_DELTA:
+      return decodeDelta(message + 1, length - 1, frame);
+    case MSG_STREAM_RLE:
+      return decodePackBits(message + 1, length - 1, frame);
+  }
+  return false;
+}
+
+static void writeMessage(FILE *out, const uint8_t *message, uint16_t length) {
+  uint8_t header[] = { (uint8_t) length, (uint8_t) (length >> 8) };
+  fwrite(header, 1, sizeof(header), out);
+  fwrite(message, 1, length, out);
+}
+
+// -/----- Main -----\-
+
+int main(int argc, char **argv) {
+  Source      source;
+  const char *outName = "stream.oled";
+  bool        fs      = false;
+  uint8_t     fps     = 30;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-raw") && i + 1 < argc) {
+      unsigned width, height;
+      if (sscanf(argv[++i], "%ux%u", &width, &height) != 2 || !width || !height) {
+        fprintf(stderr, "Expected -raw WIDTHxHEIGHT\n");
+        return 1;
+      }
+      source.raw    = true;
+      source.width  = width;
+      source.height = height;
+    } else if (!strcmp(argv[i], "-fs")) {
+      fs = true;
+    } else if (!strcmp(argv[i], "-fps") && i + 1 < argc) {
+      fps = max(1, min(atoi(argv[++i]), 255));
+    } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+      outName = argv[++i];
+    } else if (argv[i][0] == '-') {
+      fprintf(stderr, "Usage: %s [-raw WxH] [-fs] [-fps N] [-o FILE] [FILE...]\n", argv[0]);
+      return 1;
+    } else {
+      source.files.push_back(argv[i]);
+    }
+  }
+
+  FILE *out = fopen(outName, "wb");
+  if (!out) {
+    fprintf(stderr, "Could not create %s\n", outName);
+    return 1;
+  }
+  uint8_t header[] = { 'O', 'L', 'E', 'D', STREAM_VERSION, fps };
+  fwrite(header, 1, sizeof(header), out);
+
+  if (fs) {
+    fixedThresholds();
+  } else {
+    orderedThresholds();
+  }
+
+  std::vector<uint8_t> pixels;
+  static uint8_t gray[DISPLAY_WIDTH * DISPLAY_HEIGHT];
+  static uint8_t frames[2][DISPLAY_BUFFER_SIZE];
+  static uint8_t decoded[DISPLAY_BUFFER_SIZE];
+  static uint8_t message[1 + DISPLAY_BUFFER_SIZE];
+
+  uint32_t frameCount     = 0;
+  uint32_t framesSinceKey = 0;
+  uint32_t messageBytes   = 0;
+  uint32_t typeCounts[3]  = { 0, 0, 0 };
+  double   ditherNanos    = 0;
+  double   compressNanos  = 0;
+
+  while (readFrame(source, pixels)) {
+    uint8_t *frame    = frames[frameCount & 1];
+    uint8_t *previous = frameCount ? frames[(frameCount + 1) & 1] : NULL;
+
+    double start = nowNanos();
+    scale(source, pixels.data(), gray);
+    if (fs) floydSteinberg(gray);
+    pack(gray, frame);
+
+    double packed = nowNanos();
+    uint16_t length = encodeFrame(previous, frame, framesSinceKey, message);
+    double end = nowNanos();
+
+    ditherNanos   += packed - start;
+    compressNanos += end - packed;
+
+    if (!decodeMessage(message, length, decoded) || memcmp(decoded, frame, DISPLAY_BUFFER_SIZE) != 0) {
+      printf("Frame %u does not decode to itself\n", frameCount);
+      failures++;
+    }
+
+    writeMessage(out, message, length);
+    messageBytes += length;
+    typeCounts[(message[0] - MSG_FRAME_STREAM) / 2]++;
+    frameCount++;
+  }
+  fclose(out);
+
+  if (frameCount) {
+    printf("%s, %u frames, %s dithering\n", outName, frameCount, fs ? "Floyd-Steinberg" : "ordered");
+    printf("  scale+dither+pack  %8.1f us/frame\n", ditherNanos / frameCount / 1000);
+    printf("  compress           %8.1f us/frame\n", compressNanos / frameCount / 1000);
+    printf("  encoding           %8.0f frames/s\n", frameCount * 1e9 / (ditherNanos + compressNanos));
+    printf("  messages           %8.1f bytes/frame (%u full, %u delta, %u PackBits)\n",
+           (double) messageBytes / frameCount, typeCounts[0], typeCounts[1], typeCounts[2]);
+  } else {
+    printf("No frames\n");
+  }
+
+  if (failures) {
+    printf("FAILED: %u errors\n", failures);
+    return 1;
+  }
+  return 0;
+}
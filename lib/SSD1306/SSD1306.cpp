@@ -29,9 +29,27 @@
 
 
 SSD1306::SSD1306(uint8_t i2cAddress, uint8_t sda, uint8_t sdc) {
-  this->i2cAddress = i2cAddress;
-  this->sda = sda;
-  this->sdc = sdc;
+  this->transport     = new SSD1306I2C(i2cAddress, sda, sdc);
+  this->ownsTransport = true;
+}
+
+SSD1306::SSD1306(SSD1306Transport *transport) {
+  this->transport = transport;
+}
+
+SSD1306::~SSD1306() {
+  if (this->ownsTransport) delete this->transport;
+}
+
+SSD1306::SSD1306(uint8_t *buffer) {
+  this->transport = NULL;
+  this->buffer = buffer;
+  initTracking();
+}
+
+void SSD1306::setBuffer(uint8_t *buffer) {
+  this->buffer = buffer;
+  initTracking();
 }
 
 bool SSD1306::init() {
@@ -50,11 +68,11 @@ bool SSD1306::init() {
   }
   #endif
 
-  Wire.begin(this->sda, this->sdc);
+  initTracking();
 
-  // Let's use ~700khz if ESP8266 is in 160Mhz mode
-  // this will be limited to ~400khz if the ESP8266 in 80Mhz mode.
-  Wire.setClock(700000);
+  this->transport->begin();
+  this->windowCost = this->transport->getWindowCost();
+  this->chunkSize  = min(this->transport->getChunkSize(), (uint8_t) SSD1306_FLUSH_CHUNK_SIZE);
 
   sendInitCommands();
 
@@ -75,24 +93,71 @@ void SSD1306::resetDisplay(void) {
   #ifdef SSD1306_DOUBLE_BUFFER
   memset(buffer_back, 1, DISPLAY_BUFFER_SIZE);
   #endif
+  markDirty(0, DISPLAY_WIDTH - 1, 0, DISPLAY_PAGES - 1);
   display();
 }
 
 void SSD1306::reconnect() {
-  Wire.begin(this->sda, this->sdc);
+  this->transport->reconnect();
 }
 
 void SSD1306::setColor(SSD1306_COLOR color) {
   this->color = color;
 }
 
-void SSD1306::setPixel(int16_t x, int16_t y) {
+// What drawing in COLOR does to the given bits of a buffer byte. COLOR is
+// known at compile time, so the drawing loops below are instantiated once
+// per color and the public functions only pick one of them per call.
+template <SSD1306_COLOR COLOR>
+static inline void applyColor(uint8_t &target, uint8_t bits) {
+  switch (COLOR) {
+    case WHITE:   target |=  bits; break;
+    case BLACK:   target &= ~bits; break;
+    case INVERSE: target ^=  bits; break;
+  }
+}
+
+// The same for the four buffer bytes at dest, which has to be 4 byte
+// aligned. memcpy keeps the compiler from assuming anything about the
+// buffer's type and turns into a single load and store.
+template <SSD1306_COLOR COLOR>
+static inline void applyColorWord(uint8_t *dest, uint32_t bits) {
+  uint32_t word;
+  memcpy(&word, __builtin_assume_aligned(dest, 4), 4);
+  switch (COLOR) {
+    case WHITE:   word |=  bits; break;
+    case BLACK:   word &= ~bits; break;
+    case INVERSE: word ^=  bits; break;
+  }
+  memcpy(__builtin_assume_aligned(dest, 4), &word, 4);
+}
+
+// Bytes from dest up to the next 4 byte boundary. Canvas buffers can
+// start anywhere, so this goes by the address and not by the column.
+static inline int16_t bytesToWord(const uint8_t *dest, int16_t count) {
+  return min((int16_t) (-(uintptr_t) dest & 3), count);
+}
+
+// Four bytes of an image in the order they go into a buffer word
+// (little endian)
+static inline uint32_t readWord(const char *b0, const char *b1, const char *b2, const char *b3) {
+  return (uint32_t) pgm_read_byte(b0) | (uint32_t) pgm_read_byte(b1) << 8 |
+         (uint32_t) pgm_read_byte(b2) << 16 | (uint32_t) pgm_read_byte(b3) << 24;
+}
+
+template <SSD1306_COLOR COLOR>
+void SSD1306::setPixelColor(int16_t x, int16_t y) {
   if (x >= 0 && x < 128 && y >= 0 && y < 64) {
-    switch (color) {
-      case WHITE:   buffer[x + (y / 8) * DISPLAY_WIDTH] |=  (1 << (y & 7)); break;
-      case BLACK:   buffer[x + (y / 8) * DISPLAY_WIDTH] &= ~(1 << (y & 7)); break;
-      case INVERSE: buffer[x + (y / 8) * DISPLAY_WIDTH] ^=  (1 << (y & 7)); break;
-    }
+    markDirty(x, x, y >> 3, y >> 3);
+    applyColor<COLOR>(buffer[x + (y / 8) * DISPLAY_WIDTH], 1 << (y & 7));
+  }
+}
+
+void SSD1306::setPixel(int16_t x, int16_t y) {
+  switch (color) {
+    case WHITE:   setPixelColor<WHITE>(x, y);   break;
+    case BLACK:   setPixelColor<BLACK>(x, y);   break;
+    case INVERSE: setPixelColor<INVERSE>(x, y); break;
   }
 }
 
@@ -103,13 +168,48 @@ void SSD1306::drawRect(int16_t x, int16_t y, int16_t width, int16_t height) {
   drawHorizontalLine(x, y + height, width);
 }
 
+// Clip once, then fill page by page: the first and last page with a mask
+// of the rows inside the rectangle, the pages in between as whole bytes
+template <SSD1306_COLOR COLOR>
+void SSD1306::fillRectColor(int16_t xMove, int16_t yMove, int16_t width, int16_t height) {
+  int16_t xStart = max(xMove, (int16_t) 0);
+  int16_t xEnd   = min((int16_t) (xMove + width), (int16_t) DISPLAY_WIDTH);
+  int16_t yStart = max(yMove, (int16_t) 0);
+  int16_t yEnd   = min((int16_t) (yMove + height), (int16_t) DISPLAY_HEIGHT);
+  if (xStart >= xEnd || yStart >= yEnd) return;
+
+  uint8_t firstPage = yStart >> 3;
+  uint8_t lastPage  = (yEnd - 1) >> 3;
+  uint8_t length    = xEnd - xStart;
+
+  markDirty(xStart, xEnd - 1, firstPage, lastPage);
+
+  uint8_t *bufferPtr = buffer + firstPage * DISPLAY_WIDTH + xStart;
+  for (uint8_t page = firstPage; page <= lastPage; page++, bufferPtr += DISPLAY_WIDTH) {
+    uint8_t mask = 0xFF;
+    if (page == firstPage) mask &= 0xFF << (yStart & 7);
+    if (page == lastPage)  mask &= 0xFF >> (7 - ((yEnd - 1) & 7));
+
+    if (mask == 0xFF && COLOR != INVERSE) {
+      memset(bufferPtr, COLOR == WHITE ? 0xFF : 0x00, length);
+      continue;
+    }
+    for (uint8_t x = 0; x < length; x++) {
+      applyColor<COLOR>(bufferPtr[x], mask);
+    }
+  }
+}
+
 void SSD1306::fillRect(int16_t xMove, int16_t yMove, int16_t width, int16_t height) {
-  for (int16_t i = yMove; i < yMove + height; i++) {
-    drawHorizontalLine(xMove, i, width);
+  switch (color) {
+    case WHITE:   fillRectColor<WHITE>(xMove, yMove, width, height);   break;
+    case BLACK:   fillRectColor<BLACK>(xMove, yMove, width, height);   break;
+    case INVERSE: fillRectColor<INVERSE>(xMove, yMove, width, height); break;
   }
 }
 
-void SSD1306::drawHorizontalLine(int16_t x, int16_t y, int16_t length) {
+template <SSD1306_COLOR COLOR>
+void SSD1306::drawHorizontalLineColor(int16_t x, int16_t y, int16_t length) {
   if (y < 0 || y >= DISPLAY_HEIGHT) { return; }
 
   if (x < 0) {
@@ -123,35 +223,43 @@ void SSD1306::drawHorizontalLine(int16_t x, int16_t y, int16_t length) {
 
   if (length <= 0) { return; }
 
+  markDirty(x, x + length - 1, y >> 3, y >> 3);
+
   uint8_t * bufferPtr = buffer;
   bufferPtr += (y >> 3) * DISPLAY_WIDTH;
   bufferPtr += x;
 
   uint8_t drawBit = 1 << (y & 7);
 
+  while (length--) {
+    applyColor<COLOR>(*bufferPtr++, drawBit);
+  }
+}
+
+void SSD1306::drawHorizontalLine(int16_t x, int16_t y, int16_t length) {
   switch (color) {
-    case WHITE:   while (length--) {
-        *bufferPtr++ |= drawBit;
-      }; break;
-    case BLACK:   drawBit = ~drawBit;   while (length--) {
-        *bufferPtr++ &= drawBit;
-      }; break;
-    case INVERSE: while (length--) {
-        *bufferPtr++ ^= drawBit;
-      }; break;
+    case WHITE:   drawHorizontalLineColor<WHITE>(x, y, length);   break;
+    case BLACK:   drawHorizontalLineColor<BLACK>(x, y, length);   break;
+    case INVERSE: drawHorizontalLineColor<INVERSE>(x, y, length); break;
   }
 }
 
-void SSD1306::drawVerticalLine(int16_t x, int16_t y, int16_t length) {
-  if (y < 0 || y > DISPLAY_HEIGHT) return;
+template <SSD1306_COLOR COLOR>
+void SSD1306::drawVerticalLineColor(int16_t x, int16_t y, int16_t length) {
+  if (x < 0 || x >= DISPLAY_WIDTH) return;
 
-  if (x < 0) {
-    length += x;
-    x = 0;
+  if (y < 0) {
+    length += y;
+    y = 0;
   }
 
-  if (length < 0) return;
+  if ( (y + length) > DISPLAY_HEIGHT) {
+    length = (DISPLAY_HEIGHT - y);
+  }
+
+  if (length <= 0) return;
 
+  markDirty(x, x, y >> 3, (y + length - 1) >> 3);
 
   uint8_t yOffset = y & 7;
   uint8_t drawBit;
@@ -168,11 +276,7 @@ void SSD1306::drawVerticalLine(int16_t x, int16_t y, int16_t length) {
       drawBit &= (0xFF >> (yOffset - length));
     }
 
-    switch (color) {
-      case WHITE:   *bufferPtr |= drawBit; break;
-      case BLACK:   *bufferPtr &= drawBit; break;
-      case INVERSE: *bufferPtr ^= drawBit; break;
-    }
+    applyColor<COLOR>(*bufferPtr, drawBit);
 
     if (length < yOffset) return;
 
@@ -180,34 +284,62 @@ void SSD1306::drawVerticalLine(int16_t x, int16_t y, int16_t length) {
     bufferPtr += DISPLAY_WIDTH;
   }
 
-  if (length >= 8) {
-    switch (color) {
-      case WHITE:
-      case BLACK:
-        drawBit = (color == WHITE) ? 0xFF : 0x00;
-        do {
-          *bufferPtr = drawBit;
-          bufferPtr += DISPLAY_WIDTH;
-          length -= 8;
-        } while (length >= 8);
-        break;
-      case INVERSE:
-        do {
-          *bufferPtr = ~(*bufferPtr);
-          bufferPtr += DISPLAY_WIDTH;
-          length -= 8;
-        } while (length >= 8);
-        break;
+  // Whole bytes
+  while (length >= 8) {
+    switch (COLOR) {
+      case WHITE:   *bufferPtr = 0xFF;          break;
+      case BLACK:   *bufferPtr = 0x00;          break;
+      case INVERSE: *bufferPtr = ~*bufferPtr;   break;
     }
+    bufferPtr += DISPLAY_WIDTH;
+    length -= 8;
   }
 
   if (length > 0) {
-    drawBit = (1 << length & 7) - 1;
-    switch (color) {
-      case WHITE:   *bufferPtr |= drawBit; break;
-      case BLACK:   *bufferPtr &= drawBit; break;
-      case INVERSE: *bufferPtr ^= drawBit; break;
-    }
+    applyColor<COLOR>(*bufferPtr, (1 << length) - 1);
+  }
+}
+
+void SSD1306::drawVerticalLine(int16_t x, int16_t y, int16_t length) {
+  switch (color) {
+    case WHITE:   drawVerticalLineColor<WHITE>(x, y, length);   break;
+    case BLACK:   drawVerticalLineColor<BLACK>(x, y, length);   break;
+    case INVERSE: drawVerticalLineColor<INVERSE>(x, y, length); break;
+  }
+}
+
+template <SSD1306_COLOR COLOR>
+void SSD1306::drawLineColor(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  if (y0 == y1) {
+    drawHorizontalLineColor<COLOR>(min(x0, x1), y0, abs(x1 - x0) + 1);
+    return;
+  }
+  if (x0 == x1) {
+    drawVerticalLineColor<COLOR>(x0, min(y0, y1), abs(y1 - y0) + 1);
+    return;
+  }
+
+  // Bresenham
+  int16_t dx  =  abs(x1 - x0);
+  int16_t dy  = -abs(y1 - y0);
+  int8_t  sx  = x0 < x1 ? 1 : -1;
+  int8_t  sy  = y0 < y1 ? 1 : -1;
+  int16_t err = dx + dy;
+
+  while (true) {
+    setPixelColor<COLOR>(x0, y0);
+    if (x0 == x1 && y0 == y1) break;
+    int16_t e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+
+void SSD1306::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  switch (color) {
+    case WHITE:   drawLineColor<WHITE>(x0, y0, x1, y1);   break;
+    case BLACK:   drawLineColor<BLACK>(x0, y0, x1, y1);   break;
+    case INVERSE: drawLineColor<INVERSE>(x0, y0, x1, y1); break;
   }
 }
 
@@ -215,25 +347,144 @@ void SSD1306::drawFastImage(int16_t xMove, int16_t yMove, int16_t width, int16_t
   drawInternal(xMove, yMove, width, height, image, 0, 0);
 }
 
-void SSD1306::drawXbm(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *xbm) {
-  int16_t widthInXbm = (width + 7) / 8;
-  uint8_t data;
-
-  for(int16_t y = 0; y < height; y++) {
-    for(int16_t x = 0; x < width; x++ ) {
-      if (x & 7) {
-        data >>= 1; // Move a bit
-      } else {  // Read new data every 8 bit
-        data = pgm_read_byte(xbm + (x / 8) + y * widthInXbm);
+void SSD1306::drawPageImage(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *image) {
+  switch (color) {
+    case WHITE:   drawPageImageColor<WHITE, false>(xMove, yMove, width, height, image);   break;
+    case BLACK:   drawPageImageColor<BLACK, false>(xMove, yMove, width, height, image);   break;
+    case INVERSE: drawPageImageColor<INVERSE, false>(xMove, yMove, width, height, image); break;
+  }
+}
+
+void SSD1306::copyPageImage(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *image) {
+  drawPageImageColor<WHITE, true>(xMove, yMove, width, height, image);
+}
+
+// One full page of an image in page order, a word at a time
+template <SSD1306_COLOR COLOR, bool REPLACE>
+static inline void drawPageRow(uint8_t *dest, const char *src, int16_t count) {
+  if (REPLACE) {
+    memcpy_P(dest, src, count);
+    return;
+  }
+
+  int16_t x = 0;
+  for (int16_t head = bytesToWord(dest, count); x < head; x++) {
+    applyColor<COLOR>(dest[x], pgm_read_byte(src + x));
+  }
+  for (; x + 4 <= count; x += 4) {
+    applyColorWord<COLOR>(dest + x, readWord(src + x, src + x + 1, src + x + 2, src + x + 3));
+  }
+  for (; x < count; x++) {
+    applyColor<COLOR>(dest[x], pgm_read_byte(src + x));
+  }
+}
+
+// With REPLACE the pixels of the rectangle are overwritten and COLOR is
+// not used
+template <SSD1306_COLOR COLOR, bool REPLACE>
+void SSD1306::drawPageImageColor(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *image) {
+  if (width <= 0 || height <= 0) return;
+  if (xMove + width  <= 0 || xMove >= DISPLAY_WIDTH)  return;
+  if (yMove + height <= 0 || yMove >= DISPLAY_HEIGHT) return;
+
+  uint8_t pages     = (height + 7) >> 3;
+  int16_t firstPage = yMove >> 3;
+  uint8_t yOffset   = yMove & 7;
+  int16_t xStart    = max(xMove, (int16_t) 0);
+  int16_t xEnd      = min((int16_t) (xMove + width), (int16_t) DISPLAY_WIDTH);
+
+  markDirty(xStart, xEnd - 1, firstPage, firstPage + pages);
+
+  for (uint8_t p = 0; p < pages; p++) {
+    int16_t page = firstPage + p;
+    if (page >= DISPLAY_PAGES) break;
+    if (page < -1) continue;
+
+    // The last page of the image may be only partially used
+    uint8_t mask = (p == pages - 1 && (height & 7)) ? (1 << (height & 7)) - 1 : 0xFF;
+
+    const char *src    = image + p * width + (xStart - xMove);
+    uint8_t    *upper  = page >= 0 ? buffer + page * DISPLAY_WIDTH : NULL;
+    uint8_t    *lower  = (yOffset && page + 1 < DISPLAY_PAGES) ? buffer + (page + 1) * DISPLAY_WIDTH : NULL;
+
+    // A whole page on a page boundary maps byte to byte, e.g. the web frame
+    if (upper && !yOffset && mask == 0xFF) {
+      drawPageRow<COLOR, REPLACE>(upper + xStart, src, xEnd - xStart);
+      yield();
+      continue;
+    }
+
+    if (REPLACE) {
+      // Pixels of the rectangle in the two display pages
+      uint8_t upperMask = mask << yOffset;
+      uint8_t lowerMask = yOffset ? mask >> (8 - yOffset) : 0;
+
+      for (int16_t x = xStart; x < xEnd; x++) {
+        uint8_t bits = pgm_read_byte(src++) & mask;
+        if (upper) upper[x] = (upper[x] & ~upperMask) | (uint8_t) (bits << yOffset);
+        if (lower) lower[x] = (lower[x] & ~lowerMask) | (uint8_t) (bits >> (8 - yOffset));
       }
-      // if there is a bit draw it
-      if (data & 0x01) {
-        setPixel(xMove + x, yMove + y);
+      yield();
+      continue;
+    }
+
+    for (int16_t x = xStart; x < xEnd; x++) {
+      uint8_t bits = pgm_read_byte(src++) & mask;
+      if (upper) applyColor<COLOR>(upper[x], bits << yOffset);
+      if (lower) applyColor<COLOR>(lower[x], bits >> (8 - yOffset));
+    }
+    yield();
+  }
+}
+
+// Rows y .. y + rows - 1 (at most 8) of the columns x .. x + count - 1 of
+// a XBM as one page of count bytes
+static void xbmPage(const char *xbm, int16_t widthInXbm, int16_t x, int16_t count, int16_t y, uint8_t rows, uint8_t *page) {
+  memset(page, 0, count);
+  for (uint8_t row = 0; row < rows; row++) {
+    const char *line = xbm + (y + row) * widthInXbm;
+    uint8_t     bit  = 1 << row;
+    // A XBM byte at a time, empty bytes and the zeros at their end are skipped
+    for (int16_t i = 0; i < count; ) {
+      int16_t column = x + i;
+      uint8_t data   = pgm_read_byte(line + (column >> 3)) >> (column & 7);
+      int16_t end    = min((int16_t) (i + 8 - (column & 7)), count);
+      for (; data && i < end; i++, data >>= 1) {
+        if (data & 0x01) page[i] |= bit;
       }
+      i = end;
     }
   }
 }
 
+void SSD1306::xbmToPages(int16_t width, int16_t height, const char *xbm, uint8_t *pages) {
+  int16_t widthInXbm = (width + 7) / 8;
+
+  for (int16_t y = 0; y < height; y += 8) {
+    xbmPage(xbm, widthInXbm, 0, width, y, min(height - y, 8), pages + (y >> 3) * width);
+  }
+}
+
+void SSD1306::drawXbm(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *xbm) {
+  if (width <= 0 || height <= 0) return;
+
+  int16_t xStart = max(xMove, (int16_t) 0);
+  int16_t xEnd   = min((int16_t) (xMove + width), (int16_t) DISPLAY_WIDTH);
+  if (xStart >= xEnd) return;
+
+  int16_t widthInXbm = (width + 7) / 8;
+  uint8_t page[DISPLAY_WIDTH];
+
+  // Only the visible columns of the pages that reach the screen
+  for (int16_t y = 0; y < height && yMove + y < DISPLAY_HEIGHT; y += 8) {
+    if (yMove + y + 8 <= 0) continue;
+
+    uint8_t rows = min(height - y, 8);
+    xbmPage(xbm, widthInXbm, xStart - xMove, xEnd - xStart, y, rows, page);
+    drawPageImage(xStart, yMove + y, xEnd - xStart, rows, (const char *) page);
+  }
+}
+
 void SSD1306::drawStringInternal(int16_t xMove, int16_t yMove, char* text, uint16_t textLength, uint16_t textWidth) {
   uint8_t textHeight       = pgm_read_byte(fontData + HEIGHT_POS);
   uint8_t firstChar        = pgm_read_byte(fontData + FIRST_CHAR_POS);
@@ -396,208 +647,415 @@ void SSD1306::normalDisplay(void) {
 }
 
 void SSD1306::setContrast(char contrast) {
-  sendCommand(SETCONTRAST);
-  sendCommand(contrast);
+  uint8_t commands[] = { SETCONTRAST, (uint8_t) contrast };
+  sendCommands(commands, sizeof(commands));
 }
 
 void SSD1306::flipScreenVertically() {
-  sendCommand(SEGREMAP | 0x01);      //Rotate screen 180 deg
-  sendCommand(COMSCANDEC);           //Rotate screen 180 Deg
+  uint8_t commands[] = {
+    SEGREMAP | 0x01,  //Rotate screen 180 deg
+    COMSCANDEC        //Rotate screen 180 Deg
+  };
+  sendCommands(commands, sizeof(commands));
 }
 
 void SSD1306::display(void) {
-  #ifdef SSD1306_DOUBLE_BUFFER
-  uint16_t minBoundY = 8;
-  uint16_t maxBoundY = 0;
+  // Nothing changed we can savely assume that
+  // buffer_back[pos] == buffer[pos] holdes true for all values of pos
+  if (!collectChanges() || asyncFlush) return;
 
-  uint16_t minBoundX = 129;
-  uint16_t maxBoundX = 0;
+  flush();
+}
 
-  uint16_t x, y;
+void SSD1306::displayFrame(const uint8_t *frame) {
+  // Take over what was drawn so far, afterwards the reference
+  // holds what the display will show
+  bool hasChanges = collectChanges();
 
-  // Calculate the Y bounding box of changes
-  // and copy buffer[pos] to buffer_back[pos];
-  for (y = 0; y < 8; y++) {
-     for (x = 0; x < DISPLAY_WIDTH; x++) {
-      uint16_t pos = x + y * DISPLAY_WIDTH;
-      if (buffer[pos] != buffer_back[pos]) {
-        minBoundY = min(minBoundY, y);
-        maxBoundY = max(maxBoundY, y);
-        minBoundX = min(minBoundX, x);
-        maxBoundX = max(maxBoundX, x);
+  #ifdef SSD1306_DOUBLE_BUFFER
+  uint8_t *shown = buffer_back;
+  #else
+  uint8_t *shown = buffer;
+  #endif
+
+  // Compare, mark and store in a single pass over the frame
+  for (uint8_t page = 0; page < DISPLAY_PAGES; page++) {
+    uint16_t pos = page * DISPLAY_WIDTH;
+    for (uint8_t x = 0; x < DISPLAY_WIDTH; x++, pos++) {
+      uint8_t value = frame[pos];
+      if (value != shown[pos]) {
+        changedColumns[page][x >> 3] |= 1 << (x & 7);
+        shown[pos] = value;
+        hasChanges = true;
       }
-      buffer_back[pos] = buffer[pos];
+      #ifdef SSD1306_DOUBLE_BUFFER
+      buffer[pos] = value;
+      #endif
     }
     yield();
   }
 
-  // If the minBoundY wasn't updated
-  // we can savely assume that buffer_back[pos] == buffer[pos]
-  // holdes true for all values of pos
-  if (minBoundY == 8) return;
-
-  sendCommand(COLUMNADDR);
-  sendCommand(minBoundX);
-  sendCommand(maxBoundX);
-
-  sendCommand(PAGEADDR);
-  sendCommand(minBoundY);
-  sendCommand(maxBoundY);
-
-  byte k = 0;
-  for (y = minBoundY; y <= maxBoundY; y++) {
-      for (x = minBoundX; x <= maxBoundX; x++) {
-          if (k == 0) {
-            Wire.beginTransmission(this->i2cAddress);
-            Wire.write(0x40);
-          }
-          Wire.write(buffer[x + y * DISPLAY_WIDTH]);
-          k++;
-          if (k == 16)  {
-            Wire.endTransmission();
-            k = 0;
-          }
+  // Pixels may be set anywhere now
+  memset(drawnStart, 0, sizeof(drawnStart));
+  memset(drawnEnd, DISPLAY_WIDTH - 1, sizeof(drawnEnd));
+
+  if (!hasChanges || asyncFlush) return;
+
+  flush();
+}
+
+bool SSD1306::collectChanges(void) {
+  uint8_t page;
+  bool hasChanges = false;
+
+  // Only look at the regions touched by drawing since the last call
+  for (page = 0; page < DISPLAY_PAGES; page++) {
+    if (dirtyStart[page] > dirtyEnd[page]) continue;
+
+    #ifdef SSD1306_DOUBLE_BUFFER
+    // Mark every column that changed
+    // and copy buffer[pos] to buffer_back[pos];
+    for (uint16_t x = dirtyStart[page]; x <= dirtyEnd[page]; x++) {
+      uint16_t pos = x + page * DISPLAY_WIDTH;
+      if (buffer[pos] != buffer_back[pos]) {
+        changedColumns[page][x >> 3] |= 1 << (x & 7);
+        buffer_back[pos] = buffer[pos];
+        hasChanges = true;
       }
-      yield();
-  }
+    }
+    yield();
+    #else
+    // No double buffering, resend everything that was touched
+    for (uint16_t x = dirtyStart[page]; x <= dirtyEnd[page]; x++) {
+      changedColumns[page][x >> 3] |= 1 << (x & 7);
+    }
+    hasChanges = true;
+    #endif
 
-  if (k != 0) {
-    Wire.endTransmission();
+    dirtyStart[page] = DIRTY_NONE;
+    dirtyEnd[page]   = 0;
   }
 
-  #else
-  // No double buffering
-  sendCommand(COLUMNADDR);
-  sendCommand(0x0);
-  sendCommand(0x7F);
-
-  sendCommand(PAGEADDR);
-  sendCommand(0x0);
-  sendCommand(0x7);
-
-  for (uint16_t i=0; i < DISPLAY_BUFFER_SIZE; i++) {
-    Wire.beginTransmission(this->i2cAddress);
-    Wire.write(0x40);
-    for (uint8_t x = 0; x < 16; x++) {
-      Wire.write(buffer[i]);
-      i++;
+  return hasChanges;
+}
+
+void SSD1306::setAsyncFlush(bool asyncFlush) {
+  this->asyncFlush = asyncFlush;
+}
+
+void SSD1306::flush(void) {
+  while (flushStep(0xFFFFFFFF));
+}
+
+bool SSD1306::flushStep(uint32_t budgetMicros) {
+  unsigned long start = micros();
+  uint8_t startColumn, endColumn, startPage, endPage;
+
+  while (nextWindow(startColumn, endColumn, startPage, endPage)) {
+    flushing = true;
+    if (!sendWindow(startColumn, endColumn, startPage, endPage, start, budgetMicros)) {
+      // Out of time, the rest of the window stays marked
+      return true;
     }
-    i--;
-    Wire.endTransmission();
   }
-  #endif
+
+  if (flushing) {
+    flushing = false;
+    flushCount++;
+  }
+  return false;
+}
+
+uint16_t SSD1306::getFlushCount(void) {
+  return flushCount;
 }
 
 
 void SSD1306::clear(void) {
-  memset(buffer, 0, DISPLAY_BUFFER_SIZE);
+  // Only the regions drawn since the last clear can hold set pixels
+  for (uint8_t page = 0; page < DISPLAY_PAGES; page++) {
+    uint8_t start = drawnStart[page];
+    uint8_t end   = drawnEnd[page];
+    if (start > end) continue;
+
+    memset(buffer + page * DISPLAY_WIDTH + start, 0, end - start + 1);
+
+    dirtyStart[page] = min(dirtyStart[page], start);
+    dirtyEnd[page]   = max(dirtyEnd[page], end);
+    drawnStart[page] = DIRTY_NONE;
+    drawnEnd[page]   = 0;
+  }
+}
+
+uint8_t* SSD1306::getBuffer(void) {
+  return buffer;
+}
+
+uint8_t* SSD1306::beginFrame(void) {
+  markDirty(0, DISPLAY_WIDTH - 1, 0, DISPLAY_PAGES - 1);
+  return buffer;
 }
 
 
 // Private functions
 
+void SSD1306::initTracking(void) {
+  memset(this->changedColumns, 0, sizeof(this->changedColumns));
+
+  // The fresh buffer holds garbage, let the first clear() wipe all of it
+  memset(this->dirtyStart, DIRTY_NONE, sizeof(this->dirtyStart));
+  memset(this->dirtyEnd, 0, sizeof(this->dirtyEnd));
+  memset(this->drawnStart, 0, sizeof(this->drawnStart));
+  memset(this->drawnEnd, DISPLAY_WIDTH - 1, sizeof(this->drawnEnd));
+}
+
 void SSD1306::sendCommand(unsigned char com) {
-  Wire.beginTransmission(this->i2cAddress);  //begin transmitting
-  Wire.write(0x80);                          //command mode
-  Wire.write(com);
-  Wire.endTransmission();                    // stop transmitting
+  sendCommands(&com, 1);
 }
 
-void SSD1306::sendInitCommands(void) {
-  sendCommand(DISPLAYOFF);
-  sendCommand(SETDISPLAYCLOCKDIV);
-  sendCommand(0xF0); // Increase speed of the display max ~96Hz
-  sendCommand(SETMULTIPLEX);
-  sendCommand(0x3F);
-  sendCommand(SETDISPLAYOFFSET);
-  sendCommand(0x00);
-  sendCommand(SETSTARTLINE);
-  sendCommand(CHARGEPUMP);
-  sendCommand(0x14);
-  sendCommand(MEMORYMODE);
-  sendCommand(0x00);
-  sendCommand(SEGREMAP);
-  sendCommand(COMSCANINC);
-  sendCommand(SETCOMPINS);
-  sendCommand(0x12);
-  sendCommand(SETCONTRAST);
-  sendCommand(0xCF);
-  sendCommand(SETPRECHARGE);
-  sendCommand(0xF1);
-  sendCommand(DISPLAYALLON_RESUME);
-  sendCommand(NORMALDISPLAY);
-  sendCommand(0x2e);            // stop scroll
-  sendCommand(DISPLAYON);
+void SSD1306::sendCommands(const uint8_t *commands, uint16_t length) {
+  this->transport->sendCommands(commands, length);
 }
 
-void SSD1306::drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *data, uint16_t offset, uint16_t bytesInData) {
-  if (width < 0 || height < 0) return;
-  if (yMove + height < 0 || yMove > DISPLAY_HEIGHT)  return;
-  if (xMove + width  < 0 || xMove > DISPLAY_WIDTH)   return;
+void SSD1306::sendData(const uint8_t *data, uint16_t length) {
+  this->transport->sendData(data, length);
+}
 
-  uint8_t  rasterHeight = 1 + ((height - 1) >> 3); // fast ceil(height / 8.0)
-  int8_t   yOffset      = yMove & 7;
+void SSD1306::markDirty(int16_t startColumn, int16_t endColumn, int16_t startPage, int16_t endPage) {
+  if (startColumn < 0) startColumn = 0;
+  if (endColumn >= DISPLAY_WIDTH) endColumn = DISPLAY_WIDTH - 1;
+  if (startPage < 0) startPage = 0;
+  if (endPage >= DISPLAY_PAGES) endPage = DISPLAY_PAGES - 1;
+
+  for (int16_t page = startPage; page <= endPage; page++) {
+    if (startColumn < dirtyStart[page]) dirtyStart[page] = startColumn;
+    if (endColumn   > dirtyEnd[page])   dirtyEnd[page]   = endColumn;
+    if (startColumn < drawnStart[page]) drawnStart[page] = startColumn;
+    if (endColumn   > drawnEnd[page])   drawnEnd[page]   = endColumn;
+  }
+}
 
-  bytesInData = bytesInData == 0 ? width * rasterHeight : bytesInData;
+bool SSD1306::findSpan(uint8_t page, uint8_t &start, uint8_t &end) {
+  uint8_t *columns = changedColumns[page];
+  uint16_t x = 0;
 
-  int16_t initYMove   = yMove;
-  int8_t  initYOffset = yOffset;
+  // Skip unchanged columns, 8 at a time
+  while (x < DISPLAY_WIDTH && !(columns[x >> 3] >> (x & 7))) {
+    x = (x | 7) + 1;
+  }
+  if (x >= DISPLAY_WIDTH) return false;
 
+  while (!(columns[x >> 3] & (1 << (x & 7)))) x++;
+  start = end = x;
 
-  for (uint16_t i = 0; i < bytesInData; i++) {
+  // Bridge gaps of unchanged columns that are cheaper
+  // to resend than opening a new window
+  for (x++; x < DISPLAY_WIDTH && x - end <= windowCost; x++) {
+    if (columns[x >> 3] & (1 << (x & 7))) end = x;
+  }
+  return true;
+}
 
-    // Reset if next horizontal drawing phase is started.
-    if ( i % rasterHeight == 0) {
-      yMove   = initYMove;
-      yOffset = initYOffset;
+bool SSD1306::nextWindow(uint8_t &startColumn, uint8_t &endColumn, uint8_t &startPage, uint8_t &endPage) {
+  for (uint8_t page = 0; page < DISPLAY_PAGES; page++) {
+    uint8_t start, end;
+    if (!findSpan(page, start, end)) continue;
+
+    uint8_t lastPage = page;
+    uint8_t nextStart, nextEnd;
+
+    // Grow the window over the following pages as long as
+    // one window is cheaper than two separate ones
+    while (lastPage + 1 < DISPLAY_PAGES && findSpan(lastPage + 1, nextStart, nextEnd)) {
+      uint8_t  unionStart = min(start, nextStart);
+      uint8_t  unionEnd   = max(end, nextEnd);
+      uint16_t merged     = (unionEnd - unionStart + 1) * (lastPage - page + 2);
+      uint16_t separate   = (end - start + 1) * (lastPage - page + 1) + (nextEnd - nextStart + 1) + windowCost;
+      if (merged > separate) break;
+      start    = unionStart;
+      end      = unionEnd;
+      lastPage++;
     }
 
-    byte currentByte = pgm_read_byte(data + offset + i);
+    startColumn = start;
+    endColumn   = end;
+    startPage   = page;
+    endPage     = lastPage;
+    return true;
+  }
+  return false;
+}
 
-    int16_t xPos = xMove + (i / rasterHeight);
-    int16_t yPos = ((yMove >> 3) + (i % rasterHeight)) * DISPLAY_WIDTH;
+bool SSD1306::sendWindow(uint8_t startColumn, uint8_t endColumn, uint8_t startPage, uint8_t endPage, unsigned long start, uint32_t budgetMicros) {
+  uint8_t commands[] = {
+    COLUMNADDR, startColumn, endColumn,
+    PAGEADDR,   startPage,   endPage
+  };
+  sendCommands(commands, sizeof(commands));
 
-    int16_t yScreenPos = yMove + yOffset;
-    int16_t dataPos    = xPos  + yPos;
+  #ifdef SSD1306_DOUBLE_BUFFER
+  const uint8_t *source = buffer_back;
+  #else
+  const uint8_t *source = buffer;
+  #endif
+
+  // Collect the rows of the window into full sized chunks
+  // and mark every collected column as sent
+  uint8_t chunk[SSD1306_FLUSH_CHUNK_SIZE];
+  uint8_t k = 0;
+  for (uint8_t page = startPage; page <= endPage; page++) {
+    for (uint8_t x = startColumn; x <= endColumn; x++) {
+      chunk[k++] = source[x + page * DISPLAY_WIDTH];
+      changedColumns[page][x >> 3] &= ~(1 << (x & 7));
+      if (k == chunkSize)  {
+        sendData(chunk, k);
+        k = 0;
+        if (micros() - start >= budgetMicros) return false;
+      }
+    }
+    yield();
+  }
+
+  if (k != 0) {
+    sendData(chunk, k);
+  }
+  return true;
+}
+
+void SSD1306::sendInitCommands(void) {
+  static const uint8_t commands[] PROGMEM = {
+    DISPLAYOFF,
+    SETDISPLAYCLOCKDIV, 0xF0, // Increase speed of the display max ~96Hz
+    SETMULTIPLEX,       0x3F,
+    SETDISPLAYOFFSET,   0x00,
+    SETSTARTLINE,
+    CHARGEPUMP,         0x14,
+    MEMORYMODE,         0x00,
+    SEGREMAP,
+    COMSCANINC,
+    SETCOMPINS,         0x12,
+    SETCONTRAST,        0xCF,
+    SETPRECHARGE,       0xF1,
+    DISPLAYALLON_RESUME,
+    NORMALDISPLAY,
+    0x2e,                     // stop scroll
+    DISPLAYON
+  };
+
+  uint8_t batch[sizeof(commands)];
+  memcpy_P(batch, commands, sizeof(commands));
+  sendCommands(batch, sizeof(batch));
+}
+
+// The bytes of an image in the internal format are column after column,
+// rasterHeight bytes each. With ALIGNED the image starts on a page and the
+// byte for the next page is not touched.
+template <SSD1306_COLOR COLOR, bool ALIGNED>
+void SSD1306::drawInternalColor(int16_t xMove, int16_t yMove, uint8_t rasterHeight, const char *data, uint16_t bytesInData) {
+  uint8_t  yOffset = ALIGNED ? 0 : yMove & 7;
+  int16_t  pagePos = (yMove >> 3) * DISPLAY_WIDTH;
+  int16_t  xPos    = xMove;
+  uint8_t  row     = 0;
+
+  for (uint16_t i = 0; i < bytesInData; i++) {
+    byte    currentByte = pgm_read_byte(data + i);
+    int16_t dataPos     = xPos + pagePos + row * DISPLAY_WIDTH;
 
     if (dataPos >=  0  && dataPos < DISPLAY_BUFFER_SIZE &&
-        xPos    >=  0  && xPos    < DISPLAY_WIDTH ) {
-
-      if (yOffset >= 0) {
-        switch (this->color) {
-          case WHITE:   buffer[dataPos] |= currentByte << yOffset; break;
-          case BLACK:   buffer[dataPos] &= currentByte << yOffset; break;
-          case INVERSE: buffer[dataPos] ^= currentByte << yOffset; break;
-        }
-        if (dataPos < (DISPLAY_BUFFER_SIZE - DISPLAY_WIDTH)) {
-          switch (this->color) {
-            case WHITE:   buffer[dataPos + DISPLAY_WIDTH] |= currentByte >> (8 - yOffset); break;
-            case BLACK:   buffer[dataPos + DISPLAY_WIDTH] &= currentByte >> (8 - yOffset); break;
-            case INVERSE: buffer[dataPos + DISPLAY_WIDTH] ^= currentByte >> (8 - yOffset); break;
-          }
-        }
-      } else {
-        // Make new offset position
-        yOffset = -yOffset;
-
-        switch (this->color) {
-          case WHITE:   buffer[dataPos] |= currentByte >> yOffset; break;
-          case BLACK:   buffer[dataPos] &= currentByte >> yOffset; break;
-          case INVERSE: buffer[dataPos] ^= currentByte >> yOffset; break;
-        }
-
-        // Prepare for next iteration by moving one block up
-        yMove -= 8;
-
-        // and setting the new yOffset
-        yOffset = 8 - yOffset;
+        xPos    >=  0  && xPos    < DISPLAY_WIDTH) {
+      applyColor<COLOR>(buffer[dataPos], currentByte << yOffset);
+      if (dataPos < (DISPLAY_BUFFER_SIZE - DISPLAY_WIDTH) && !ALIGNED) {
+        applyColor<COLOR>(buffer[dataPos + DISPLAY_WIDTH], currentByte >> (8 - yOffset));
       }
+    }
 
+    if (++row == rasterHeight) {
+      row = 0;
+      xPos++;
       yield();
     }
   }
 }
 
+template <SSD1306_COLOR COLOR>
+void SSD1306::drawInternalAligned(int16_t xMove, int16_t yMove, int16_t width, uint8_t rasterHeight, const char *data) {
+  uint8_t *pageStart = buffer + (yMove >> 3) * DISPLAY_WIDTH + xMove;
+
+  // Single columns up to the next word boundary of the buffer, the pages
+  // are DISPLAY_WIDTH apart so all of them line up the same way
+  int16_t head = bytesToWord(pageStart, width);
+  int16_t x    = 0;
+
+  for (; x < head; x++) {
+    const char *column = data + x * rasterHeight;
+    uint8_t    *dest   = pageStart + x;
+    for (uint8_t page = 0; page < rasterHeight; page++, dest += DISPLAY_WIDTH) {
+      applyColor<COLOR>(*dest, pgm_read_byte(column + page));
+    }
+  }
+
+  // Four columns are 4 * rasterHeight bytes in a row in the image and one
+  // word per page in the buffer
+  for (; x + 4 <= width; x += 4) {
+    const char *column = data + x * rasterHeight;
+    uint8_t    *dest   = pageStart + x;
+    for (uint8_t page = 0; page < rasterHeight; page++, dest += DISPLAY_WIDTH) {
+      const char *bytes = column + page;
+      applyColorWord<COLOR>(dest, readWord(bytes, bytes + rasterHeight, bytes + 2 * rasterHeight, bytes + 3 * rasterHeight));
+    }
+  }
+
+  for (; x < width; x++) {
+    const char *column = data + x * rasterHeight;
+    uint8_t    *dest   = pageStart + x;
+    for (uint8_t page = 0; page < rasterHeight; page++, dest += DISPLAY_WIDTH) {
+      applyColor<COLOR>(*dest, pgm_read_byte(column + page));
+    }
+  }
+  yield();
+}
+
+void SSD1306::drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *data, uint16_t offset, uint16_t bytesInData) {
+  if (width < 0 || height < 0) return;
+  if (yMove + height < 0 || yMove > DISPLAY_HEIGHT)  return;
+  if (xMove + width  < 0 || xMove > DISPLAY_WIDTH)   return;
+
+  uint8_t  rasterHeight = 1 + ((height - 1) >> 3); // fast ceil(height / 8.0)
+  int8_t   yOffset      = yMove & 7;
+
+  bytesInData = bytesInData == 0 ? width * rasterHeight : bytesInData;
+
+  markDirty(xMove, xMove + width - 1, yMove >> 3, (yMove >> 3) + rasterHeight);
+
+  if (yOffset == 0 && bytesInData == width * rasterHeight &&
+      xMove >= 0 && xMove + width <= DISPLAY_WIDTH &&
+      yMove >= 0 && yMove + rasterHeight * 8 <= DISPLAY_HEIGHT) {
+    data += offset;
+    switch (this->color) {
+      case WHITE:   drawInternalAligned<WHITE>(xMove, yMove, width, rasterHeight, data);   break;
+      case BLACK:   drawInternalAligned<BLACK>(xMove, yMove, width, rasterHeight, data);   break;
+      case INVERSE: drawInternalAligned<INVERSE>(xMove, yMove, width, rasterHeight, data); break;
+    }
+    return;
+  }
+
+  data += offset;
+  switch (this->color) {
+    case WHITE:
+      if (yOffset) drawInternalColor<WHITE, false>(xMove, yMove, rasterHeight, data, bytesInData);
+      else         drawInternalColor<WHITE, true>(xMove, yMove, rasterHeight, data, bytesInData);
+      break;
+    case BLACK:
+      if (yOffset) drawInternalColor<BLACK, false>(xMove, yMove, rasterHeight, data, bytesInData);
+      else         drawInternalColor<BLACK, true>(xMove, yMove, rasterHeight, data, bytesInData);
+      break;
+    case INVERSE:
+      if (yOffset) drawInternalColor<INVERSE, false>(xMove, yMove, rasterHeight, data, bytesInData);
+      else         drawInternalColor<INVERSE, true>(xMove, yMove, rasterHeight, data, bytesInData);
+      break;
+  }
+}
+
 // Code form http://playground.arduino.cc/Main/Utf8ascii
 uint8_t SSD1306::utf8ascii(byte ascii) {
   static uint8_t LASTCHAR;
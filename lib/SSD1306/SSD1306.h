@@ -28,8 +28,9 @@
 #pragma once
 
 #include <Arduino.h>
-#include <Wire.h>
 
+#include "SSD1306Transport.h"
+#include "SSD1306I2C.h"
 #include "SSD1306Fonts.h"
 
 //#define DEBUG_SSD1306(...) Serial.printf( __VA_ARGS__ )
@@ -48,6 +49,17 @@
 #define DISPLAY_WIDTH 128
 #define DISPLAY_HEIGHT 64
 #define DISPLAY_BUFFER_SIZE 1024
+#define DISPLAY_PAGES (DISPLAY_HEIGHT / 8)
+
+// Marks an empty column range in the dirty map
+#define DIRTY_NONE 0xFF
+
+// Pixel data is handed to the transport in chunks of its getChunkSize(),
+// at most this many bytes. flushStep() checks its time budget after each
+// chunk.
+#ifndef SSD1306_FLUSH_CHUNK_SIZE
+#define SSD1306_FLUSH_CHUNK_SIZE 64
+#endif
 
 // Header Values
 #define JUMPTABLE_BYTES 4
@@ -107,9 +119,10 @@ enum SSD1306_TEXT_ALIGNMENT {
 class SSD1306 {
   private:
 
-    uint8_t             i2cAddress;
-    uint8_t             sda;
-    uint8_t             sdc;
+    SSD1306Transport   *transport;
+    bool                ownsTransport = false;
+    uint8_t             windowCost;
+    uint8_t             chunkSize;
 
     uint8_t            *buffer;
 
@@ -117,6 +130,44 @@ class SSD1306 {
     uint8_t            *buffer_back;
     #endif
 
+    // Column range per page touched by drawing since the last display()
+    uint8_t             dirtyStart[DISPLAY_PAGES];
+    uint8_t             dirtyEnd[DISPLAY_PAGES];
+
+    // Column range per page drawn since the last clear()
+    uint8_t             drawnStart[DISPLAY_PAGES];
+    uint8_t             drawnEnd[DISPLAY_PAGES];
+
+    // One bit per column and page that still needs to be sent
+    uint8_t             changedColumns[DISPLAY_PAGES][DISPLAY_WIDTH / 8];
+
+    // Record that the given columns and pages were written to
+    inline void markDirty(int16_t startColumn, int16_t endColumn, int16_t startPage, int16_t endPage) __attribute__((always_inline));
+
+    // Start with nothing to send and everything to clear
+    void initTracking(void);
+
+    // Mark the columns that changed since the last call as to be sent
+    // (and take the snapshot with SSD1306_DOUBLE_BUFFER)
+    bool collectChanges(void);
+
+    // Find the next span of changed columns in the given page
+    bool findSpan(uint8_t page, uint8_t &start, uint8_t &end);
+
+    // Plan the next address window to send
+    bool nextWindow(uint8_t &startColumn, uint8_t &endColumn, uint8_t &startPage, uint8_t &endPage);
+
+    // Send the buffer content inside the given address window, returns false
+    // if the time budget ran out before the whole window was sent
+    bool sendWindow(uint8_t startColumn, uint8_t endColumn, uint8_t startPage, uint8_t endPage, unsigned long start, uint32_t budgetMicros);
+
+    // Leave sending the changes to flushStep()
+    bool                asyncFlush = false;
+
+    // A flush was started but did not finish yet
+    bool                flushing   = false;
+    uint16_t            flushCount = 0;
+
     SSD1306_TEXT_ALIGNMENT   textAlignment = TEXT_ALIGN_LEFT;
     SSD1306_COLOR            color         = WHITE;
 
@@ -125,6 +176,12 @@ class SSD1306 {
     // Send a command to the display (low level function)
     void sendCommand(unsigned char com);
 
+    // Send a sequence of commands
+    void sendCommands(const uint8_t *commands, uint16_t length);
+
+    // Send pixel data
+    void sendData(const uint8_t *data, uint16_t length);
+
     // Send all the init commands
     void sendInitCommands(void);
 
@@ -132,14 +189,47 @@ class SSD1306 {
     byte utf8ascii(byte ascii);
     char* utf8ascii(String s);
 
+    // Color specific versions of the drawing functions, the public ones
+    // dispatch on the color once per call
+    template <SSD1306_COLOR COLOR> inline void setPixelColor(int16_t x, int16_t y) __attribute__((always_inline));
+    template <SSD1306_COLOR COLOR> void drawHorizontalLineColor(int16_t x, int16_t y, int16_t length);
+    template <SSD1306_COLOR COLOR> void drawVerticalLineColor(int16_t x, int16_t y, int16_t length);
+    template <SSD1306_COLOR COLOR> void fillRectColor(int16_t x, int16_t y, int16_t width, int16_t height);
+    template <SSD1306_COLOR COLOR> void drawLineColor(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+    template <SSD1306_COLOR COLOR, bool REPLACE> void drawPageImageColor(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *image);
+    template <SSD1306_COLOR COLOR, bool ALIGNED> void drawInternalColor(int16_t xMove, int16_t yMove, uint8_t rasterHeight, const char *data, uint16_t bytesInData);
+
+    // drawInternal for images on page boundaries and fully on the screen
+    template <SSD1306_COLOR COLOR> void drawInternalAligned(int16_t xMove, int16_t yMove, int16_t width, uint8_t rasterHeight, const char *data);
+
     inline void drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const char *data, uint16_t offset, uint16_t bytesInData) __attribute__((always_inline));
 
     void drawStringInternal(int16_t xMove, int16_t yMove, char* text, uint16_t textLength, uint16_t textWidth);
   public:
 
-    // Create the display object connected to pin sda and sdc
+    // Create the display object connected via I2C to pin sda and sdc
     SSD1306(uint8_t i2cAddress, uint8_t sda, uint8_t sdc);
 
+    // Create the display object connected through the given transport,
+    // e.g. SSD1306I2C or SSD1306Spi
+    SSD1306(SSD1306Transport *transport);
+
+    // Deletes the transport if it was created by the I2C constructor
+    ~SSD1306();
+
+    // A copy would delete the same transport twice
+    SSD1306(const SSD1306&) = delete;
+    SSD1306& operator=(const SSD1306&) = delete;
+
+    // Create a canvas drawing into the given page-major buffer
+    // (DISPLAY_BUFFER_SIZE bytes) instead of a display. Only the drawing
+    // functions may be used, clear() only wipes what was drawn through
+    // this object.
+    SSD1306(uint8_t *buffer);
+
+    // Let a canvas draw into another buffer, forgets what was drawn before
+    void setBuffer(uint8_t *buffer);
+
     // Initialize the display
     bool init();
 
@@ -149,7 +239,7 @@ class SSD1306 {
     // Cycle through the initialization
     void resetDisplay(void);
 
-    // Connect again to the display through I2C
+    // Connect again to the display
     void reconnect(void);
 
     /* Drawing functions */
@@ -172,12 +262,31 @@ class SSD1306 {
     // Draw a lin vertically
     void drawVerticalLine(int16_t x, int16_t y, int16_t length);
 
+    // Draw a line from (x0, y0) to (x1, y1) including both ends
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+
     // Draw a bitmap in the internal image format
     void drawFastImage(int16_t x, int16_t y, int16_t width, int16_t height, const char *image);
 
-    // Draw a XBM
+    // Draw a bitmap in the display's own page-major format: every byte holds
+    // 8 vertical pixels, the bytes of one page (8 pixel row) follow each other
+    // (data[x + (y / 8) * width]). A full screen image is a copy of the buffer.
+    void drawPageImage(int16_t x, int16_t y, int16_t width, int16_t height, const char *image);
+
+    // Replace the pixels inside the rectangle with an image in page order,
+    // 0 bits clear pixels whatever the color is
+    void copyPageImage(int16_t x, int16_t y, int16_t width, int16_t height, const char *image);
+
+    // Draw a XBM. The visible part is converted into page order one page
+    // at a time on every call.
     void drawXbm(int16_t x, int16_t y, int16_t width, int16_t height, const char *xbm);
 
+    // Convert a XBM (rows of (width + 7) / 8 bytes, lowest bit leftmost) into
+    // the format of drawPageImage, pages needs width * ((height + 7) / 8) bytes.
+    // Images drawn often are cheaper to convert once (or at build time, see
+    // host/assets.cpp) and draw with drawPageImage.
+    static void xbmToPages(int16_t width, int16_t height, const char *xbm, uint8_t *pages);
+
     /* Text functions */
 
     // Draws a string at the given location
@@ -224,7 +333,39 @@ class SSD1306 {
     // Write the buffer to the display memory
     void display(void);
 
+    // Replace the whole buffer with a frame in page order (DISPLAY_BUFFER_SIZE
+    // bytes, see drawPageImage) kept elsewhere and display it. Compare,
+    // mark and store happen in a single pass over the frame instead of
+    // drawing it and diffing it again in display(). A frame that can be
+    // written into the buffer directly is cheaper with beginFrame().
+    void displayFrame(const uint8_t *frame);
+
+    // Don't block in display(), it only takes a snapshot of the changes
+    // which are then sent by calling flushStep() repeatedly.
+    // Without SSD1306_DOUBLE_BUFFER there is no snapshot, drawing before
+    // the flush finished may show up early.
+    void setAsyncFlush(bool asyncFlush);
+
+    // Send pending changes for about budgetMicros (at least one transaction).
+    // Returns true if there is more left to send.
+    bool flushStep(uint32_t budgetMicros);
+
+    // Send all pending changes
+    void flush(void);
+
+    // Number of flushes that finished, i.e. updates that reached the
+    // display. Wraps around, use the difference to measure the frame rate.
+    uint16_t getFlushCount(void);
+
     // Clear the local pixel buffer
     void clear(void);
 
+    // Access the local pixel buffer (page-major, DISPLAY_BUFFER_SIZE bytes)
+    uint8_t* getBuffer(void);
+
+    // The local pixel buffer, to be overwritten with a whole frame in page
+    // order. It is marked as drawn, the next display() compares all of it.
+    // A frame replaced before that display() costs only its own write.
+    uint8_t* beginFrame(void);
+
 };
@@ -0,0 +1,69 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "SSD1306I2C.h"
+
+SSD1306I2C::SSD1306I2C(uint8_t i2cAddress, uint8_t sda, uint8_t sdc) {
+  this->i2cAddress = i2cAddress;
+  this->sda = sda;
+  this->sdc = sdc;
+}
+
+void SSD1306I2C::begin(void) {
+  Wire.begin(this->sda, this->sdc);
+
+  // Let's use ~700khz if ESP8266 is in 160Mhz mode
+  // this will be limited to ~400khz if the ESP8266 in 80Mhz mode.
+  Wire.setClock(700000);
+}
+
+void SSD1306I2C::sendCommands(const uint8_t *commands, uint16_t length) {
+  send(0x00, commands, length);                // command stream
+}
+
+void SSD1306I2C::sendData(const uint8_t *data, uint16_t length) {
+  send(0x40, data, length);                    // data stream
+}
+
+uint8_t SSD1306I2C::getWindowCost(void) {
+  return SSD1306_I2C_WINDOW_COST;
+}
+
+uint8_t SSD1306I2C::getChunkSize(void) {
+  return SSD1306_I2C_CHUNK_SIZE;
+}
+
+void SSD1306I2C::send(uint8_t control, const uint8_t *data, uint16_t length) {
+  while (length) {
+    uint8_t chunk = min(length, (uint16_t) SSD1306_I2C_CHUNK_SIZE);
+    Wire.beginTransmission(this->i2cAddress);  // begin transmitting
+    Wire.write(control);
+    Wire.write(data, chunk);
+    Wire.endTransmission();                    // stop transmitting
+    data   += chunk;
+    length -= chunk;
+  }
+}
@@ -0,0 +1,67 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include "SSD1306Transport.h"
+
+// Payload bytes sent per I2C transaction, the Wire buffer
+// also needs to hold the control byte.
+#ifndef SSD1306_I2C_CHUNK_SIZE
+#ifdef BUFFER_LENGTH
+#define SSD1306_I2C_CHUNK_SIZE (BUFFER_LENGTH - 1)
+#else
+#define SSD1306_I2C_CHUNK_SIZE 31
+#endif
+#endif
+
+// One command transaction and a new data transaction
+#ifndef SSD1306_I2C_WINDOW_COST
+#define SSD1306_I2C_WINDOW_COST 10
+#endif
+
+class SSD1306I2C : public SSD1306Transport {
+  private:
+    uint8_t             i2cAddress;
+    uint8_t             sda;
+    uint8_t             sdc;
+
+    // Send a control byte followed by up to length bytes per transaction
+    void send(uint8_t control, const uint8_t *data, uint16_t length);
+
+  public:
+    // Connect to the display at i2cAddress on pin sda and sdc
+    SSD1306I2C(uint8_t i2cAddress, uint8_t sda, uint8_t sdc);
+
+    void begin(void);
+    void sendCommands(const uint8_t *commands, uint16_t length);
+    void sendData(const uint8_t *data, uint16_t length);
+    uint8_t getWindowCost(void);
+    uint8_t getChunkSize(void);
+};
@@ -0,0 +1,80 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#include "SSD1306Spi.h"
+
+SSD1306Spi::SSD1306Spi(uint8_t rst, uint8_t dc, uint8_t cs, uint32_t frequency) {
+  this->rst = rst;
+  this->dc  = dc;
+  this->cs  = cs;
+  this->frequency = frequency;
+}
+
+void SSD1306Spi::begin(void) {
+  pinMode(this->dc, OUTPUT);
+  pinMode(this->cs, OUTPUT);
+  pinMode(this->rst, OUTPUT);
+
+  digitalWrite(this->cs, HIGH);
+
+  SPI.begin();
+  SPI.setFrequency(this->frequency);
+
+  // Pulse reset, the display needs at least 3us
+  digitalWrite(this->rst, HIGH);
+  delay(1);
+  digitalWrite(this->rst, LOW);
+  delay(10);
+  digitalWrite(this->rst, HIGH);
+}
+
+void SSD1306Spi::reconnect(void) {
+  SPI.begin();
+  SPI.setFrequency(this->frequency);
+}
+
+void SSD1306Spi::sendCommands(const uint8_t *commands, uint16_t length) {
+  send(LOW, commands, length);
+}
+
+void SSD1306Spi::sendData(const uint8_t *data, uint16_t length) {
+  send(HIGH, data, length);
+}
+
+uint8_t SSD1306Spi::getWindowCost(void) {
+  return SSD1306_SPI_WINDOW_COST;
+}
+
+uint8_t SSD1306Spi::getChunkSize(void) {
+  return SSD1306_SPI_CHUNK_SIZE;
+}
+
+void SSD1306Spi::send(uint8_t dcLevel, const uint8_t *data, uint16_t length) {
+  digitalWrite(this->dc, dcLevel);
+  digitalWrite(this->cs, LOW);
+  SPI.writeBytes((uint8_t *) data, length);
+  digitalWrite(this->cs, HIGH);
+}
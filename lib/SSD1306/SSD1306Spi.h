@@ -0,0 +1,66 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#include "SSD1306Transport.h"
+
+// Only the six address commands, SPI has no per transfer overhead
+#ifndef SSD1306_SPI_WINDOW_COST
+#define SSD1306_SPI_WINDOW_COST 6
+#endif
+
+// SPI.writeBytes takes any length, the chunk size only sets how
+// often flushStep() checks its time budget (64 bytes take 64us at 8 MHz)
+#ifndef SSD1306_SPI_CHUNK_SIZE
+#define SSD1306_SPI_CHUNK_SIZE 64
+#endif
+
+class SSD1306Spi : public SSD1306Transport {
+  private:
+    uint8_t             rst;
+    uint8_t             dc;
+    uint8_t             cs;
+    uint32_t            frequency;
+
+    // Send bytes with the data/command line set to dcLevel
+    void send(uint8_t dcLevel, const uint8_t *data, uint16_t length);
+
+  public:
+    // Connect to a 4-wire SPI display using the hardware SPI pins
+    // (SCLK: D5, MOSI: D7 on a NodeMCU) plus reset, data/command and chip select
+    SSD1306Spi(uint8_t rst, uint8_t dc, uint8_t cs, uint32_t frequency = 8000000);
+
+    void begin(void);
+    void reconnect(void);
+    void sendCommands(const uint8_t *commands, uint16_t length);
+    void sendData(const uint8_t *data, uint16_t length);
+    uint8_t getWindowCost(void);
+    uint8_t getChunkSize(void);
+};
@@ -0,0 +1,55 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2016 by Daniel Eichhorn
+ * Copyright (c) 2016 by Fabrice Weinberg
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+// The bus the display is connected to. SSD1306 only talks to
+// the display through this interface.
+class SSD1306Transport {
+  public:
+    virtual ~SSD1306Transport() {}
+
+    // Setup the bus and the display, called on init
+    virtual void begin(void) = 0;
+
+    // Setup the bus again without resetting the display
+    virtual void reconnect(void) { begin(); }
+
+    // Send a sequence of commands
+    virtual void sendCommands(const uint8_t *commands, uint16_t length) = 0;
+
+    // Send pixel data to the current address window
+    virtual void sendData(const uint8_t *data, uint16_t length) = 0;
+
+    // Bytes worth of bus time it costs to open a new address window,
+    // changed spans closer than this are sent together
+    virtual uint8_t getWindowCost(void) = 0;
+
+    // Pixel bytes handed to sendData at once while flushing
+    virtual uint8_t getChunkSize(void) = 0;
+};
@@ -18,30 +18,32 @@ void drawClock(SSD1306 *display, int16_t x, int16_t y, int timeOffset, String ci
   display->setTextAlignment(TEXT_ALIGN_LEFT);
   display->setFont(ArialMT_Plain_10);
   display->drawString(x + 60, y + 5, city);
-  display->drawXbm(x, y, 60, 60, icon);
+  display->drawPageImage(x, y, 60, 60, icon);
   display->setFont(ArialMT_Plain_16);
   display->drawString(x + 60, y + 24, getFormattedTime(timeOffset));
 }
 
 void webFrame(SSD1306 *display, SSD1306UiState* state, int16_t x, int16_t y){
   ui.disableIndicator();
-  display->drawFastImage(x, y, 128, 64, webImage);
+  runQueuedCommands();
+  display->drawPageImage(x, y, 128, 64, composeLayers());
+  frameShown();
 }
 
 void berlinFrame(SSD1306 *display, SSD1306UiState* state, int16_t x, int16_t y){
-  drawClock(display, x, y, 3600, "Berlin", berlin_bits);
+  drawClock(display, x, y, 3600, "Berlin", berlin_pages);
 }
 
 void parisFrame(SSD1306 *display, SSD1306UiState* state, int16_t x, int16_t y){
-  drawClock(display, x, y, 3600, "Paris", berlin_bits);
+  drawClock(display, x, y, 3600, "Paris", berlin_pages);
 }
 
 void newYorkFrame(SSD1306 *display, SSD1306UiState* state, int16_t x, int16_t y){
-  drawClock(display, x, y, -3600 * 5, "New York", new_york_bits);
+  drawClock(display, x, y, -3600 * 5, "New York", new_york_pages);
 }
 
 void londonFrame(SSD1306 *display, SSD1306UiState* state, int16_t x, int16_t y) {
-  drawClock(display, x, y, 0, "London",  london_bits);
+  drawClock(display, x, y, 0, "London",  london_pages);
 }
 
 
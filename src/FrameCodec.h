@@ -0,0 +1,193 @@
+// Encodings for frames in display page order (DISPLAY_BUFFER_SIZE bytes).
+// The same encoders exist in srcweb/frameCodec.js.
+//
+// Delta: the changes against the previous frame as a sequence of runs
+//   skip (1 byte)   unchanged bytes to pass
+//   count (1 byte)  changed bytes that follow
+//   count bytes     the new values
+// Gaps longer than 255 bytes use runs with a count of 0, unchanged bytes
+// at the end of the frame are left out.
+//
+// PackBits: a whole frame as a sequence of
+//   n = 0..127      n + 1 literal bytes follow
+//   n = 129..255    the next byte repeats 257 - n times
+//   n = 128         no operation
+// The dithered frames have long runs of 0x00 and 0xFF.
+//
+// Both decoders only touch as many bytes as they are given plus at most
+// one frame, which keeps them well inside a loop() iteration. The check
+// functions walk the same structure without writing, so a message can be
+// rejected before anything is changed.
+
+// Bytes of a gap that are cheaper to send than to start a new run for
+#define DELTA_RUN_HEADER 2
+
+// True if data is a well formed delta
+bool checkDelta(const uint8_t *data, size_t length) {
+  uint16_t pos = 0;
+  size_t   i   = 0;
+
+  while (i + DELTA_RUN_HEADER <= length) {
+    pos += data[i];
+    uint8_t count = data[i + 1];
+    i += DELTA_RUN_HEADER;
+
+    if (pos + count > DISPLAY_BUFFER_SIZE || count > length - i) return false;
+
+    pos += count;
+    i   += count;
+  }
+  return i == length;
+}
+
+// Apply a delta to frame, returns false if the data is malformed.
+// frame may be partly updated in that case.
+bool decodeDelta(const uint8_t *data, size_t length, uint8_t *frame) {
+  uint16_t pos = 0;
+  size_t   i   = 0;
+
+  while (i + DELTA_RUN_HEADER <= length) {
+    pos += data[i];
+    uint8_t count = data[i + 1];
+    i += DELTA_RUN_HEADER;
+
+    if (pos + count > DISPLAY_BUFFER_SIZE || count > length - i) return false;
+
+    memcpy(frame + pos, data + i, count);
+    pos += count;
+    i   += count;
+  }
+  return i == length;
+}
+
+// Encode the changes from previous to frame into out. Returns the encoded
+// length, or -1 if it would exceed maxLength (send the full frame instead).
+int16_t encodeDelta(const uint8_t *previous, const uint8_t *frame, uint8_t *out, uint16_t maxLength) {
+  uint16_t length = 0;
+  uint16_t last   = 0; // End of the previous run
+  uint16_t pos    = 0;
+
+  while (pos < DISPLAY_BUFFER_SIZE) {
+    if (frame[pos] == previous[pos]) {
+      pos++;
+      continue;
+    }
+
+    // Find the end of the run, bridging gaps that cost less than a header
+    uint16_t end = pos + 1;
+    uint16_t gap = 0;
+    while (end + gap < DISPLAY_BUFFER_SIZE && end - pos + gap < 255) {
+      if (frame[end + gap] != previous[end + gap]) {
+        end += gap + 1;
+        gap  = 0;
+      } else if (++gap > DELTA_RUN_HEADER) {
+        break;
+      }
+    }
+
+    uint16_t skip = pos - last;
+    while (skip > 255) {
+      if (length + DELTA_RUN_HEADER > maxLength) return -1;
+      out[length++] = 255;
+      out[length++] = 0;
+      skip -= 255;
+    }
+
+    uint16_t count = end - pos;
+    if (length + DELTA_RUN_HEADER + count > maxLength) return -1;
+    out[length++] = skip;
+    out[length++] = count;
+    memcpy(out + length, frame + pos, count);
+    length += count;
+
+    last = pos = end;
+  }
+  return length;
+}
+
+// Longest run PackBits can express
+#define PACKBITS_MAX_RUN 128
+
+// Decode a PackBits compressed frame into frame, returns false unless the
+// data holds exactly one frame. frame may be partly updated in that case.
+bool decodePackBits(const uint8_t *data, size_t length, uint8_t *frame) {
+  uint16_t pos = 0;
+  size_t   i   = 0;
+
+  while (i < length) {
+    uint8_t n = data[i++];
+    if (n < 128) {
+      uint8_t count = n + 1;
+      if (pos + count > DISPLAY_BUFFER_SIZE || count > length - i) return false;
+      memcpy(frame + pos, data + i, count);
+      i += count;
+      pos += count;
+    } else if (n > 128) {
+      uint16_t count = 257 - n;
+      if (pos + count > DISPLAY_BUFFER_SIZE || i >= length) return false;
+      memset(frame + pos, data[i++], count);
+      pos += count;
+    }
+  }
+  return pos == DISPLAY_BUFFER_SIZE;
+}
+
+// True if data is a well formed PackBits frame
+bool checkPackBits(const uint8_t *data, size_t length) {
+  uint16_t pos = 0;
+  size_t   i   = 0;
+
+  while (i < length) {
+    uint8_t n = data[i++];
+    if (n < 128) {
+      uint8_t count = n + 1;
+      if (pos + count > DISPLAY_BUFFER_SIZE || count > length - i) return false;
+      i   += count;
+      pos += count;
+    } else if (n > 128) {
+      uint16_t count = 257 - n;
+      if (pos + count > DISPLAY_BUFFER_SIZE || i >= length) return false;
+      i++;
+      pos += count;
+    }
+  }
+  return pos == DISPLAY_BUFFER_SIZE;
+}
+
+// PackBits compress frame into out. Returns the encoded length, or -1 if it
+// would exceed maxLength (send the full frame instead).
+int16_t encodePackBits(const uint8_t *frame, uint8_t *out, uint16_t maxLength) {
+  uint16_t length = 0;
+  uint16_t pos    = 0;
+
+  while (pos < DISPLAY_BUFFER_SIZE) {
+    // Length of the run starting at pos
+    uint16_t run = 1;
+    while (pos + run < DISPLAY_BUFFER_SIZE && run < PACKBITS_MAX_RUN && frame[pos + run] == frame[pos]) {
+      run++;
+    }
+
+    if (run >= 2) {
+      if (length + 2 > maxLength) return -1;
+      out[length++] = 257 - run;
+      out[length++] = frame[pos];
+      pos += run;
+      continue;
+    }
+
+    // Collect literals up to the next run of at least three bytes
+    uint16_t end = pos + 1;
+    while (end < DISPLAY_BUFFER_SIZE && end - pos < PACKBITS_MAX_RUN) {
+      if (end + 2 < DISPLAY_BUFFER_SIZE && frame[end] == frame[end + 1] && frame[end] == frame[end + 2]) break;
+      end++;
+    }
+
+    uint16_t count = end - pos;
+    if (length + 1 + count > maxLength) return -1;
+    out[length++] = count - 1;
+    memcpy(out + length, frame + pos, count);
+    length += count;
+    pos = end;
+  }
+  return length;
+}
@@ -0,0 +1,30 @@
+// Only the newest frame is shown. Frames are decoded into webImage as
+// they arrive, the WebSocket payload is gone after the callback and
+// decoding costs about as much as keeping a copy of it. While streaming,
+// whole frames go into the display buffer instead (see
+// SSD1306::beginFrame). A frame that arrives before the previous one was
+// shown replaces it, the web frame draws the newest one or, while
+// streaming, it is handed to the display (compared, marked and flushed)
+// once per loop.
+// The counters are sent to the clients, see MSG_STATS.
+
+// The slot holds a frame that was not shown yet
+bool     framePending    = false;
+
+uint32_t framesTotal     = 0;
+uint32_t framesDisplayed = 0;
+uint32_t framesDropped   = 0;
+
+// A new frame is in the slot
+void frameReceived() {
+  framesTotal++;
+  if (framePending) framesDropped++;
+  framePending = true;
+}
+
+// The frame in the slot was handed to the display
+void frameShown() {
+  if (!framePending) return;
+  framePending = false;
+  framesDisplayed++;
+}
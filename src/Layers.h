@@ -0,0 +1,161 @@
+// Every client draws into its own layer (DISPLAY_BUFFER_SIZE bytes in page
+// order), allocated when it first draws and freed when it disconnects.
+// Frames, deltas and commands always refer to the sender's layer, the web
+// frame shows the layers according to layerPolicy:
+//   LAYER_OWNER     the first client to draw owns the web frame until it
+//                   disconnects or did not draw for LAYER_OWNER_TIMEOUT ms,
+//                   drawing of the other clients is ignored
+//   LAYER_PRIORITY  the layer of the client with the highest priority
+//                   (OP_PRIORITY), ties go to the lower client number
+//   LAYER_OR        all layers ORed together
+//
+// A client that builds a frame from several messages sends MSG_COMMIT when
+// it is complete. From its first commit on the client draws into a back
+// buffer while the web frame shows the front, a commit swaps the two.
+// Clients that never commit draw straight into the front, a single message
+// is handled at once and can't tear a frame.
+enum LayerPolicy {
+  LAYER_OWNER,
+  LAYER_PRIORITY,
+  LAYER_OR
+};
+
+// Change as you like
+LayerPolicy   layerPolicy = LAYER_OWNER;
+
+#define LAYER_OWNER_TIMEOUT 5000
+#define NO_CLIENT           0xFF
+
+// Front buffers, shown by the web frame
+char*         layers[WEBSOCKETS_SERVER_CLIENT_MAX];
+// Back buffers of the clients that commit, NULL for the others
+char*         layerBacks[WEBSOCKETS_SERVER_CLIENT_MAX];
+// The back still holds the frame before the last commit
+bool          layerBackStale[WEBSOCKETS_SERVER_CLIENT_MAX];
+uint8_t       layerPriority[WEBSOCKETS_SERVER_CLIENT_MAX];
+
+// The layer webImage and webCanvas point to, see useLayer() in WebSocket.h
+uint8_t       layerClient = NO_CLIENT;
+
+uint8_t       layerOwner  = NO_CLIENT;
+unsigned long lastOwnerDraw = 0;
+
+// A layer was drawn to, swapped or freed since composedImage was combined
+bool          layersChanged = true;
+
+// Allocate the layer of a client about to draw, returns false if the
+// policy or the memory does not allow it
+bool claimLayer(uint8_t num) {
+  if (layerPolicy == LAYER_OWNER && layerOwner != NO_CLIENT && layerOwner != num &&
+      millis() - lastOwnerDraw < LAYER_OWNER_TIMEOUT) {
+    return false;
+  }
+
+  if (!layers[num]) {
+    layers[num] = (char*) malloc(DISPLAY_BUFFER_SIZE);
+    if (!layers[num]) return false;
+    memset(layers[num], 0, DISPLAY_BUFFER_SIZE);
+  }
+
+  if (layerPolicy == LAYER_OWNER) {
+    layerOwner    = num;
+    lastOwnerDraw = millis();
+  }
+  return true;
+}
+
+// The buffer the client's messages go into
+char *drawingBuffer(uint8_t num) {
+  return layerBacks[num] ? layerBacks[num] : layers[num];
+}
+
+// Bring the back of the drawing client up to the committed frame before
+// changing only part of it. After a commit this is the only copy, and only
+// if the next message does not replace the whole frame anyway.
+void syncBack() {
+  if (layerClient == NO_CLIENT || !layerBackStale[layerClient]) return;
+  memcpy(layerBacks[layerClient], layers[layerClient], DISPLAY_BUFFER_SIZE);
+  layerBackStale[layerClient] = false;
+}
+
+// The whole webImage is about to be replaced, no need to sync it
+void replaceBack() {
+  if (layerClient != NO_CLIENT) layerBackStale[layerClient] = false;
+}
+
+// Show what the drawing client drew since the last commit by swapping its
+// front and back. The first commit creates the back, returns false if
+// there is no memory for it.
+bool commitLayer() {
+  uint8_t num = layerClient;
+  if (num == NO_CLIENT) return false;
+
+  if (!layerBacks[num]) {
+    layerBacks[num] = (char*) malloc(DISPLAY_BUFFER_SIZE);
+    if (!layerBacks[num]) return false;
+    memcpy(layerBacks[num], layers[num], DISPLAY_BUFFER_SIZE);
+  } else {
+    char *front     = layers[num];
+    layers[num]     = layerBacks[num];
+    layerBacks[num] = front;
+    layerBackStale[num] = true;
+  }
+  layersChanged = true;
+
+  webImage = layerBacks[num];
+  webCanvas.setBuffer((uint8_t *) webImage);
+  return true;
+}
+
+// Client whose layer alone makes up the web frame, NO_CLIENT if nobody
+// drew yet or several layers are ORed
+uint8_t shownClient() {
+  uint8_t shown = NO_CLIENT;
+
+  switch (layerPolicy) {
+    case LAYER_OWNER:
+      return layerOwner;
+    case LAYER_PRIORITY:
+      for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+        if (layers[num] && (shown == NO_CLIENT || layerPriority[num] > layerPriority[shown])) {
+          shown = num;
+        }
+      }
+      return shown;
+    case LAYER_OR:
+      for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+        if (!layers[num]) continue;
+        if (shown != NO_CLIENT) return NO_CLIENT;
+        shown = num;
+      }
+      return shown;
+  }
+  return shown;
+}
+
+// The image the web frame shows. Only LAYER_OR with several layers has
+// to combine them, four bytes at a time into composedImage, and only
+// after one of them changed.
+const char *composeLayers() {
+  uint8_t shown = shownClient();
+  if (shown != NO_CLIENT) {
+    // composedImage is not kept up to date meanwhile
+    layersChanged = true;
+    return layers[shown];
+  }
+  if (!layersChanged) return composedImage;
+  layersChanged = false;
+
+  uint32_t *out = (uint32_t *) composedImage;
+  memset(out, 0, DISPLAY_BUFFER_SIZE);
+  if (layerPolicy != LAYER_OR) return composedImage;
+
+  for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+    if (!layers[num]) continue;
+    const uint32_t *layer = (const uint32_t *) layers[num];
+    for (uint16_t i = 0; i < DISPLAY_BUFFER_SIZE / 4; i++) {
+      out[i] |= layer[i];
+    }
+  }
+  return composedImage;
+}
@@ -73,12 +73,14 @@ LoadingStage loadingStages[] = {
           display.setTextAlignment(TEXT_ALIGN_CENTER_BOTH);
           display.drawString(64, 32, "Restart");
           display.display();
+          display.flush();
         });
 
         ArduinoOTA.onProgress([](unsigned int progress, unsigned int total) {
           display.drawRect(4, 32, 120, 8);
           display.fillRect(4 + 2, 32 + 2, (120 * ((float)progress / total) - 3), 8 - 3);
           display.display();
+          display.flush();
         });
 
         ArduinoOTA.begin();
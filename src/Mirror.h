@@ -0,0 +1,66 @@
+// Opt-in mirror of what the display shows, e.g. for dashboards. Clients
+// subscribe with OP_MIRROR and first get the full frame, then the changes
+// at most every MIRROR_INTERVAL ms. The delta is encoded once and the
+// same message goes to every subscriber.
+#define MIRROR_INTERVAL  100
+
+// Sent to the subscribers
+#define MSG_MIRROR_FRAME 0x0A // Frame in display page order
+#define MSG_MIRROR_DELTA 0x0B // Changes against the last mirror frame, see FrameCodec.h
+
+// One bit per client number
+uint8_t       mirrorClients    = 0;
+static_assert(WEBSOCKETS_SERVER_CLIENT_MAX <= 8, "mirrorClients has one bit per client");
+
+// Last frame sent, the deltas refer to it
+uint8_t       mirrorImage[DISPLAY_BUFFER_SIZE];
+uint8_t       mirrorMessage[1 + DISPLAY_BUFFER_SIZE];
+uint16_t      mirrorFlushCount = 0;
+unsigned long lastMirror       = 0;
+
+void setMirror(uint8_t num, bool on) {
+  if (!on) {
+    mirrorClients &= ~(1 << num);
+    return;
+  }
+
+  if (!mirrorClients) {
+    memcpy(mirrorImage, display.getBuffer(), DISPLAY_BUFFER_SIZE);
+  }
+  mirrorClients |= 1 << num;
+
+  // Start the new subscriber with the frame the next delta refers to
+  mirrorMessage[0] = MSG_MIRROR_FRAME;
+  memcpy(mirrorMessage + 1, mirrorImage, DISPLAY_BUFFER_SIZE);
+  webSocket.sendBIN(num, mirrorMessage, sizeof(mirrorMessage));
+}
+
+// Send what changed on the display since the last call, called from loop()
+void updateMirror() {
+  if (!mirrorClients || millis() - lastMirror < MIRROR_INTERVAL) return;
+
+  // Only look at the buffer if something new reached the display
+  uint16_t flushCount = display.getFlushCount();
+  if (flushCount == mirrorFlushCount) return;
+  mirrorFlushCount = flushCount;
+  lastMirror       = millis();
+
+  const uint8_t *frame = display.getBuffer();
+  int16_t length = encodeDelta(mirrorImage, frame, mirrorMessage + 1, DISPLAY_BUFFER_SIZE - 2);
+  if (length == 0) return;
+
+  if (length > 0) {
+    mirrorMessage[0] = MSG_MIRROR_DELTA;
+  } else {
+    mirrorMessage[0] = MSG_MIRROR_FRAME;
+    memcpy(mirrorMessage + 1, frame, DISPLAY_BUFFER_SIZE);
+    length = DISPLAY_BUFFER_SIZE;
+  }
+  memcpy(mirrorImage, frame, DISPLAY_BUFFER_SIZE);
+
+  for (uint8_t num = 0; num < WEBSOCKETS_SERVER_CLIENT_MAX; num++) {
+    if (mirrorClients & (1 << num)) {
+      webSocket.sendBIN(num, mirrorMessage, 1 + length);
+    }
+  }
+}
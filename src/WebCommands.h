@@ -0,0 +1,184 @@
+// Drawing and ui commands sent as MSG_COMMANDS, many per message.
+// Every command is an opcode followed by fixed size operands, coordinates
+// are single bytes. Drawing goes into the sender's layer (see Layers.h)
+// and starts with WHITE.
+#define OP_COLOR           0x01 // color
+#define OP_PIXEL           0x02 // x, y
+#define OP_LINE            0x03 // x0, y0, x1, y1
+#define OP_RECT            0x04 // x, y, width, height
+#define OP_FILL_RECT       0x05 // x, y, width, height
+#define OP_BLIT            0x06 // x, y, width, height, then width * ((height + 7) / 8)
+                                // bytes in page order (see drawPageImage)
+#define OP_CLEAR           0x07
+#define OP_NEXT_FRAME      0x08
+#define OP_PREVIOUS_FRAME  0x09
+#define OP_AUTO_TRANSITION 0x0A // 0 disables, 1 enables
+#define OP_MIRROR          0x0B // 1 subscribes to the display mirror, 0 ends it
+#define OP_PRIORITY        0x0C // priority of the sender's layer for LAYER_PRIORITY
+
+// Operand bytes per opcode
+const uint8_t opOperandBytes[] = { 0, 1, 2, 4, 4, 4, 4, 0, 0, 0, 1, 1, 1 };
+#define OP_COUNT (sizeof(opOperandBytes) / sizeof(opOperandBytes[0]))
+
+// Drawing commands wait in a queue until the web frame is drawn, so a
+// burst of messages costs one pass per ui tick. A clear drops everything
+// queued before it. Blits are not queued, they run the queue first.
+// The queue only holds commands for the layer in webImage.
+#define COMMAND_QUEUE_SIZE 128
+
+// See WebSocket.h
+bool useLayer(uint8_t num);
+
+struct QueuedCommand {
+  uint8_t op;
+  uint8_t color;
+  uint8_t args[4];
+};
+
+QueuedCommand commandQueue[COMMAND_QUEUE_SIZE];
+uint8_t       commandQueueStart  = 0;
+uint8_t       commandQueueLength = 0;
+bool          clearQueued        = false;
+
+// Apply all queued commands to webImage
+void runQueuedCommands() {
+  if (clearQueued) {
+    // Frames are written around webCanvas, setBuffer() makes it forget
+    // its drawn ranges so clear() wipes the whole layer
+    webCanvas.setBuffer((uint8_t *) webImage);
+    webCanvas.clear();
+    replaceBack();
+    clearQueued   = false;
+    layersChanged = true;
+  } else if (commandQueueLength > 0) {
+    syncBack();
+    layersChanged = true;
+  }
+
+  for (; commandQueueLength > 0; commandQueueLength--) {
+    QueuedCommand &command = commandQueue[commandQueueStart];
+    commandQueueStart = (commandQueueStart + 1) % COMMAND_QUEUE_SIZE;
+
+    webCanvas.setColor((SSD1306_COLOR) command.color);
+    switch (command.op) {
+      case OP_PIXEL:
+        webCanvas.setPixel(command.args[0], command.args[1]);
+        break;
+      case OP_LINE:
+        webCanvas.drawLine(command.args[0], command.args[1], command.args[2], command.args[3]);
+        break;
+      case OP_RECT:
+        webCanvas.drawRect(command.args[0], command.args[1], command.args[2], command.args[3]);
+        break;
+      case OP_FILL_RECT:
+        webCanvas.fillRect(command.args[0], command.args[1], command.args[2], command.args[3]);
+        break;
+    }
+  }
+}
+
+// Forget the queued commands, e.g. because a frame replaces webImage
+void dropQueuedCommands() {
+  commandQueueLength = 0;
+  clearQueued = false;
+}
+
+void queueClear() {
+  dropQueuedCommands();
+  clearQueued = true;
+}
+
+void queueCommand(uint8_t op, uint8_t color, const uint8_t *args) {
+  if (commandQueueLength > 0) {
+    // Drawing the same in WHITE or BLACK again changes nothing
+    QueuedCommand &last = commandQueue[(commandQueueStart + commandQueueLength - 1) % COMMAND_QUEUE_SIZE];
+    if (last.op == op && last.color == color && color != INVERSE &&
+        memcmp(last.args, args, opOperandBytes[op]) == 0) {
+      return;
+    }
+  }
+
+  if (commandQueueLength == COMMAND_QUEUE_SIZE) {
+    runQueuedCommands();
+  }
+
+  QueuedCommand &command = commandQueue[(commandQueueStart + commandQueueLength) % COMMAND_QUEUE_SIZE];
+  command.op    = op;
+  command.color = color;
+  memcpy(command.args, args, opOperandBytes[op]);
+  commandQueueLength++;
+}
+
+// Queue or run the commands, returns false if the data ended in the middle
+// of a command or held an unknown opcode. Commands before that are kept.
+// Drawing is skipped if the layer policy does not let the client draw.
+bool handleCommands(uint8_t num, const uint8_t *data, size_t length) {
+  size_t  i     = 0;
+  uint8_t color = WHITE;
+  // Only claim a layer once the client actually draws
+  bool    layerChecked = false;
+  bool    canDraw      = false;
+
+  while (i < length) {
+    uint8_t op = data[i++];
+    if (op == 0 || op >= OP_COUNT || opOperandBytes[op] > length - i) return false;
+
+    const uint8_t *args = data + i;
+    i += opOperandBytes[op];
+
+    if ((op >= OP_PIXEL && op <= OP_CLEAR) && !layerChecked) {
+      layerChecked = true;
+      canDraw      = useLayer(num);
+    }
+
+    switch (op) {
+      case OP_COLOR:
+        color = min(args[0], INVERSE);
+        break;
+      case OP_PIXEL:
+      case OP_LINE:
+      case OP_RECT:
+      case OP_FILL_RECT:
+        if (canDraw) queueCommand(op, color, args);
+        break;
+      case OP_BLIT: {
+        uint16_t bytes = args[2] * ((args[3] + 7) / 8);
+        if (bytes > length - i) return false;
+        if (!canDraw) {
+          i += bytes;
+          break;
+        }
+        runQueuedCommands();
+        syncBack();
+        webCanvas.setColor((SSD1306_COLOR) color);
+        webCanvas.drawPageImage(args[0], args[1], args[2], args[3], (const char *) data + i);
+        layersChanged = true;
+        i += bytes;
+        break;
+      }
+      case OP_CLEAR:
+        if (canDraw) queueClear();
+        break;
+      case OP_NEXT_FRAME:
+        ui.nextFrame();
+        break;
+      case OP_PREVIOUS_FRAME:
+        ui.previousFrame();
+        break;
+      case OP_AUTO_TRANSITION:
+        if (args[0]) {
+          ui.enableAutoTransition();
+        } else {
+          ui.disableAutoTransition();
+        }
+        break;
+      case OP_MIRROR:
+        setMirror(num, args[0]);
+        break;
+      case OP_PRIORITY:
+        layerPriority[num] = args[0];
+        break;
+    }
+  }
+  return true;
+}
@@ -1,15 +1,302 @@
+// Binary messages start with a type byte followed by the payload.
+// A message of exactly DISPLAY_BUFFER_SIZE bytes without type
+// is a frame in the old column-major internal image format. All typed
+// messages except full frames (MSG_FRAME_PAGE, MSG_FRAME_STREAM) have to
+// be shorter than that, validMessage() rejects longer ones.
+#define MSG_FRAME_PAGE   0x01 // Frame in display page order (DISPLAY_BUFFER_SIZE bytes)
+#define MSG_FRAME_STREAM 0x02 // Same as MSG_FRAME_PAGE, part of a video
+#define MSG_FRAME_DELTA  0x03 // Changes against the last frame, see FrameCodec.h
+#define MSG_STREAM_DELTA 0x04 // Same as MSG_FRAME_DELTA, part of a video
+#define MSG_FRAME_RLE    0x05 // PackBits compressed frame, see FrameCodec.h
+#define MSG_STREAM_RLE   0x06 // Same as MSG_FRAME_RLE, part of a video
+#define MSG_COMMANDS     0x07 // Drawing and ui commands, see WebCommands.h
+#define MSG_FRAME_PART   0x0C // Offset into the frame (uint16 LE) followed by
+                              // bytes in display page order to write there
+#define MSG_FRAME_RECT   0x0D // x, y, width, height, then width * ((height + 7) / 8)
+                              // bytes in page order replacing that rectangle
+#define MSG_COMMIT       0x0E // Show what was drawn since the last commit,
+                              // see Layers.h
+
+// Sent to the clients
+#define MSG_ACK          0x08 // Frames accepted from this client (uint16 LE),
+                              // display updates per second (uint8)
+#define MSG_STATS        0x09 // Frames received, displayed and dropped
+                              // (uint32 LE each, see FrameSlot.h), once per second
+// MSG_MIRROR_FRAME and MSG_MIRROR_DELTA, see Mirror.h
+
+// While the web frame is shown the ui is paused and video frames bypass
+// it: whole frames are written straight into the display buffer, decoded
+// ones into webImage, and the newest is sent once per loop. Streaming ends
+// with any other message of the streaming client or when no frame arrived
+// for STREAM_TIMEOUT ms.
+#define STREAM_TIMEOUT      500
+// Time in ms given to flushStep() per loop while streaming
+#define STREAM_FLUSH_BUDGET 5
+
+// The last streamed frame only went into the display buffer
+bool webImageBehind = false;
+
+// Every accepted frame is acknowledged so the clients can limit the frames
+// in flight instead of filling up the network buffers
+uint16_t      framesReceived[WEBSOCKETS_SERVER_CLIENT_MAX];
+
+// Display updates per second, measured in loop()
+uint8_t       displayRate    = 0;
+uint16_t      rateFlushCount = 0;
+unsigned long rateStart      = 0;
+
+void putUint32(uint8_t *data, uint32_t value) {
+  data[0] = value;
+  data[1] = value >> 8;
+  data[2] = value >> 16;
+  data[3] = value >> 24;
+}
+
+// Measure the display rate and send the frame counters
+void reportStats() {
+  if (millis() - rateStart < 1000) return;
+
+  uint16_t flushCount = display.getFlushCount();
+  displayRate    = min((uint16_t) (flushCount - rateFlushCount), 255);
+  rateFlushCount = flushCount;
+  rateStart      = millis();
+
+  uint8_t stats[1 + 3 * 4] = { MSG_STATS };
+  putUint32(stats + 1, framesTotal);
+  putUint32(stats + 5, framesDisplayed);
+  putUint32(stats + 9, framesDropped);
+  webSocket.broadcastBIN(stats, sizeof(stats));
+}
+
+bool isFrameType(uint8_t type) {
+  return (type >= MSG_FRAME_PAGE && type <= MSG_STREAM_RLE) || type == MSG_FRAME_PART || type == MSG_FRAME_RECT;
+}
+
+// Check a typed message before it changes anything. Commands are checked
+// one by one while they are handled.
+bool validMessage(const uint8_t * payload, size_t length) {
+  const uint8_t *data       = payload + 1;
+  size_t         dataLength = length - 1;
+
+  if (length >= DISPLAY_BUFFER_SIZE && payload[0] != MSG_FRAME_PAGE && payload[0] != MSG_FRAME_STREAM) return false;
+
+  switch (payload[0]) {
+    case MSG_FRAME_PAGE:
+    case MSG_FRAME_STREAM:
+      return dataLength == DISPLAY_BUFFER_SIZE;
+    case MSG_FRAME_DELTA:
+    case MSG_STREAM_DELTA:
+      return checkDelta(data, dataLength);
+    case MSG_FRAME_RLE:
+    case MSG_STREAM_RLE:
+      return checkPackBits(data, dataLength);
+    case MSG_FRAME_PART:
+      return dataLength >= 2 && (data[0] | (data[1] << 8)) + dataLength - 2 <= DISPLAY_BUFFER_SIZE;
+    case MSG_FRAME_RECT:
+      return dataLength >= 4 && data[2] > 0 && data[3] > 0 &&
+             (size_t) data[2] * ((data[3] + 7) / 8) + 4 == dataLength;
+    case MSG_COMMANDS:
+      return true;
+    case MSG_COMMIT:
+      return dataLength == 0;
+  }
+  return false;
+}
+
+void acknowledgeFrame(uint8_t num) {
+  uint16_t frames = ++framesReceived[num];
+  uint8_t  ack[]  = { MSG_ACK, (uint8_t) frames, (uint8_t) (frames >> 8), displayRate };
+  webSocket.sendBIN(num, ack, sizeof(ack));
+}
+
+// Only a layer shown on its own and without a back buffer can go
+// straight to the display
+bool canStream(uint8_t num) {
+  SSD1306UiState* state = ui.getUiState();
+  return state->frameState == FIXED && frames[state->currentFrame] == webFrame &&
+         shownClient() == num && !layerBacks[num];
+}
+
+// Bring webImage up to the last frame streamed into the display buffer
+// before changing only part of it
+void syncWebImage() {
+  syncBack();
+  if (!webImageBehind) return;
+  webImageBehind = false;
+  memcpy(webImage, display.getBuffer(), DISPLAY_BUFFER_SIZE);
+  layersChanged  = true;
+}
+
+void stopStreaming() {
+  if (!streaming) return;
+  streaming = false;
+  syncWebImage();
+}
+
+// Hand the newest frame to the display, called once per loop. Whole
+// frames are already in its buffer, decoded ones still in webImage.
+void presentStreamFrame() {
+  if (!streaming || !framePending) return;
+  if (webImageBehind) {
+    display.display();
+  } else {
+    display.displayFrame((uint8_t *) webImage);
+  }
+  frameShown();
+}
+
+// Point webImage and webCanvas at the layer of the client about to draw,
+// returns false if it may not draw. The queued commands and a streamed
+// frame belong to the previous layer and are finished first.
+bool useLayer(uint8_t num) {
+  if (!claimLayer(num)) return false;
+  if (num == layerClient) return true;
+
+  stopStreaming();
+  runQueuedCommands();
+  layerClient = num;
+  webImage    = drawingBuffer(num);
+  webCanvas.setBuffer((uint8_t *) webImage);
+  return true;
+}
+
+// Free the layer of a client that connected or disconnected
+void releaseLayer(uint8_t num) {
+  if (num == layerClient) {
+    stopStreaming();
+    dropQueuedCommands();
+    layerClient = NO_CLIENT;
+    webImage    = composedImage;
+    webCanvas.setBuffer((uint8_t *) webImage);
+  }
+  if (num == layerOwner) layerOwner = NO_CLIENT;
+
+  free(layers[num]);
+  free(layerBacks[num]);
+  layers[num]         = NULL;
+  layerBacks[num]     = NULL;
+  layerBackStale[num] = false;
+  layerPriority[num]  = 0;
+  layersChanged       = true;
+}
+
+// Returns true if the message was a frame and went into the layer
+bool handleBinaryMessage(uint8_t num, uint8_t * payload, size_t length) {
+  if (length == DISPLAY_BUFFER_SIZE) {
+    if (!useLayer(num)) return false;
+    stopStreaming();
+    dropQueuedCommands();
+    replaceBack();
+    // Reorder the columns of the old format into pages
+    for (uint8_t page = 0; page < DISPLAY_HEIGHT / 8; page++) {
+      for (uint8_t x = 0; x < DISPLAY_WIDTH; x++) {
+        webImage[x + page * DISPLAY_WIDTH] = payload[x * (DISPLAY_HEIGHT / 8) + page];
+      }
+    }
+    layersChanged = true;
+    frameReceived();
+    return true;
+  }
+  if (length == 0 || !validMessage(payload, length)) return false;
+
+  uint8_t type   = payload[0];
+  if ((isFrameType(type) || type == MSG_COMMIT) && !useLayer(num)) return false;
+  // Also when decoding fails half way
+  if (isFrameType(type)) layersChanged = true;
+
+  // Messages of other clients leave the stream alone
+  bool    stream = (type == MSG_FRAME_STREAM || type == MSG_STREAM_DELTA || type == MSG_STREAM_RLE) && canStream(num);
+  if (!stream && num == layerClient) stopStreaming();
+
+  switch (type) {
+    case MSG_FRAME_PAGE:
+    case MSG_FRAME_STREAM:
+      dropQueuedCommands();
+      replaceBack();
+      if (stream) {
+        // Latest wins in the display buffer, presentStreamFrame() compares
+        // it once per loop and webImage is updated when the stream stops
+        memcpy(display.beginFrame(), payload + 1, DISPLAY_BUFFER_SIZE);
+        webImageBehind = true;
+      } else {
+        memcpy(webImage, payload + 1, DISPLAY_BUFFER_SIZE);
+      }
+      frameReceived();
+      break;
+    case MSG_FRAME_DELTA:
+    case MSG_STREAM_DELTA:
+      syncWebImage();
+      runQueuedCommands();
+      if (!decodeDelta(payload + 1, length - 1, (uint8_t *) webImage)) return false;
+      frameReceived();
+      break;
+    case MSG_FRAME_RLE:
+    case MSG_STREAM_RLE:
+      // A whole frame, no need to sync the back buffer first
+      dropQueuedCommands();
+      if (!decodePackBits(payload + 1, length - 1, (uint8_t *) webImage)) return false;
+      replaceBack();
+      webImageBehind = false;
+      frameReceived();
+      break;
+    case MSG_FRAME_PART: {
+      uint16_t offset = payload[1] | (payload[2] << 8);
+      syncWebImage();
+      runQueuedCommands();
+      memcpy(webImage + offset, payload + 3, length - 3);
+      frameReceived();
+      break;
+    }
+    case MSG_FRAME_RECT:
+      // Clipped by copyPageImage, y does not have to be on a page
+      syncWebImage();
+      runQueuedCommands();
+      webCanvas.copyPageImage(payload[1], payload[2], payload[3], payload[4], (const char *) payload + 5);
+      frameReceived();
+      break;
+    case MSG_COMMANDS:
+      handleCommands(num, payload + 1, length - 1);
+      break;
+    case MSG_COMMIT:
+      runQueuedCommands();
+      commitLayer();
+      break;
+    default:
+      return false;
+  }
+
+  if (stream) {
+    streaming = true;
+    lastStreamFrame = millis();
+  }
+  return isFrameType(type);
+}
+
 // Websocket callback
 void webSocketCallback(uint8_t num, WStype_t type, uint8_t * payload, size_t length) {
     switch(type) {
+        case WStype_CONNECTED:
+            framesReceived[num] = 0;
+            setMirror(num, false);
+            releaseLayer(num);
+            break;
+        case WStype_DISCONNECTED:
+            setMirror(num, false);
+            releaseLayer(num);
+            break;
         case WStype_BIN:
-            memcpy(webImage, payload, length * sizeof(uint8_t));
+            if (handleBinaryMessage(num, payload, length)) {
+              acknowledgeFrame(num);
+            }
             break;
         case WStype_TEXT:
+            if (num == layerClient) stopStreaming();
+
             char* data = (char *) payload;
             if (data[0] == 'd') {
               uint8_t color;
-              int x;
-              int y;
+              int x = -1;
+              int y = -1;
 
               char* command = strtok(data, ":");
               byte i = 0;
@@ -28,9 +315,13 @@ void webSocketCallback(uint8_t num, WStype_t type, uint8_t * payload, size_t len
                   command = strtok(NULL, ":");
                   i++;
               }
-              webImage[x * (DISPLAY_HEIGHT/8) + y / 8] |=  (1 << (y & 7));
+              // Missing or out of range coordinates would wrap around
+              if (x < 0 || x >= DISPLAY_WIDTH || y < 0 || y >= DISPLAY_HEIGHT) break;
+
+              uint8_t args[] = { (uint8_t) x, (uint8_t) y };
+              if (useLayer(num)) queueCommand(OP_PIXEL, WHITE, args);
             } else if (data[0] == 'c') {
-              memset(webImage, 0, DISPLAY_BUFFER_SIZE);
+              if (useLayer(num)) queueClear();
             } else if (data[0] == 'n') {
               ui.nextFrame();
             } else if (data[0] == 'p') {
@@ -0,0 +1,620 @@
+// Generated by host/assets.cpp (make icons), do not edit.
+// Images in display page order, draw them with drawPageImage.
+
+// From src/icons.h
+
+#define amsterdam_width 60
+#define amsterdam_height 60
+const char amsterdam_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x18, 0xF8, 0xD8, 0xD8, 0xD8,
+  0xD8, 0xD8, 0xD8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60, 0xFF, 0x00, 0xFF, 0xB6, 0xB6, 0xB6,
+  0xB6, 0xB6, 0xB6, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xE0, 0xF0, 0x18, 0xFC, 0xFC, 0x16, 0xF3, 0xF3, 0x11, 0xF1, 0xE0,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xFF, 0x80, 0xFF, 0x6D, 0x6D, 0x6D,
+  0x6D, 0x6D, 0x6D, 0x7F, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x38, 0x70, 0xC0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x2F,
+  0x2B, 0x2F, 0x2F, 0x28, 0x2F, 0x2F, 0x28, 0x2F, 0xAF, 0xF8, 0x7F, 0x0F,
+  0x02, 0x73, 0xFB, 0xD9, 0xF9, 0xF9, 0xD8, 0xF9, 0xF9, 0xD9, 0xFB, 0x72,
+  0x06, 0x1C, 0x78, 0xE0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+  0xA3, 0xBE, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0x3A, 0x0E,
+  0x0A, 0x0A, 0x0A, 0x0A, 0xEA, 0xEA, 0x6A, 0xEA, 0xCA, 0x0A, 0x0A, 0x0A,
+  0x0E, 0x0E, 0x7B, 0xF3, 0x7F, 0x7F, 0x41, 0x7F, 0x7F, 0x41, 0x7F, 0x7F,
+  0x41, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x78,
+  0xF8, 0xBC, 0x6C, 0xEC, 0x6C, 0x3C, 0x00, 0xE0, 0xFF, 0x87, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0xA0, 0xA7, 0xAF, 0xAC, 0xAF, 0xA7, 0xA0, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x9F, 0xFE, 0x00, 0x08, 0x3C, 0x6C, 0xEC, 0x6C, 0xBC,
+  0xF0, 0x38, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x07, 0x0F, 0x0C, 0x18, 0x30, 0x60, 0x60, 0xFF, 0xFF, 0xDE,
+  0xDE, 0xDE, 0xDE, 0x5E, 0xFE, 0xFE, 0x06, 0xFE, 0xFE, 0x5E, 0xDE, 0xDE,
+  0xDE, 0xDE, 0xFF, 0xFF, 0x60, 0x20, 0x30, 0x18, 0x0C, 0x07, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define austin_width 60
+#define austin_height 60
+const char austin_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x70, 0xC0, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xF8, 0xF8,
+  0xFC, 0xFC, 0x36, 0xF2, 0xF3, 0x31, 0x31, 0x31, 0xF3, 0x36, 0x36, 0xFC,
+  0x3C, 0xF8, 0xF0, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xE0, 0x30, 0x18, 0x0C, 0x04, 0x06, 0x03, 0x01, 0x01, 0xFF, 0xFF,
+  0x03, 0x03, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0F,
+  0x00, 0xFF, 0xFF, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x38, 0x70, 0xC0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7C, 0x07,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xDF, 0xFF,
+  0xE4, 0xC4, 0xE4, 0xF4, 0xDC, 0xCC, 0xCC, 0xDC, 0xFC, 0xE4, 0xC4, 0xE4,
+  0xF4, 0xDF, 0xDF, 0xFC, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xF8, 0x18,
+  0x0F, 0x0E, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xC0, 0xC0,
+  0xC0, 0x60, 0x30, 0x30, 0x30, 0x30, 0x60, 0xC0, 0x80, 0xC0, 0xFF, 0x0F,
+  0x1D, 0xF1, 0xF0, 0x63, 0x63, 0x40, 0xC0, 0x60, 0x63, 0x60, 0xF0, 0xF8,
+  0x0C, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0x04, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x8C, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x70,
+  0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xCF, 0xCF, 0xCF, 0x4F, 0x78,
+  0x00, 0x07, 0x0F, 0x0F, 0x0F, 0x0F, 0xFF, 0x0F, 0x0F, 0x0F, 0x0F, 0x07,
+  0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xE0, 0x38, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x07, 0x0C, 0x08, 0x18, 0x30, 0x60, 0x7E, 0xFF, 0xC7, 0x8F,
+  0x9B, 0xB3, 0xE3, 0xC3, 0x83, 0x03, 0xFF, 0x03, 0x83, 0xC3, 0xE3, 0xB3,
+  0x9B, 0x8F, 0xC7, 0xFF, 0x78, 0x20, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define barcelona_width 60
+#define barcelona_height 60
+const char barcelona_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xE0, 0xB0, 0xF0,
+  0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0xE0, 0xB0, 0xF0, 0xE0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x18, 0xBC, 0xEC, 0xFC, 0x18, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x7F,
+  0xE0, 0xC0, 0x40, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x40, 0xC0,
+  0xF0, 0x3F, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x10, 0x38, 0xFC, 0xEC, 0x38,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xE0, 0xFC, 0x87, 0xBE, 0xFC, 0x04, 0x06, 0x83, 0xFF, 0x0F, 0x0A, 0x02,
+  0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+  0x0F, 0x0A, 0x00, 0x1F, 0xFF, 0x03, 0x06, 0x8C, 0xFC, 0x5F, 0x4F, 0xFC,
+  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0xFF,
+  0xFF, 0x00, 0x52, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0x00, 0xFD, 0xF8,
+  0x00, 0xFF, 0x00, 0x00, 0xE0, 0x38, 0x18, 0xF8, 0xC0, 0x00, 0xFF, 0xFF,
+  0x00, 0xFD, 0xF8, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x28, 0x03,
+  0xFF, 0xFE, 0x78, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xFF, 0x00, 0xFF,
+  0x03, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xDF, 0x8F,
+  0x00, 0x07, 0x66, 0x6E, 0xFF, 0xF8, 0xF0, 0xF8, 0xFF, 0x24, 0x6F, 0x07,
+  0x00, 0xDF, 0x8F, 0x00, 0xFF, 0xFF, 0xF0, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x7F,
+  0xE0, 0x80, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xF3, 0xF1,
+  0x00, 0xFE, 0xFF, 0x7F, 0x07, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFE,
+  0x00, 0xF3, 0xF1, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x80,
+  0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x07, 0x0E, 0x0C, 0x1F, 0x30, 0x7F, 0x7F, 0xC0, 0xFF, 0xFF,
+  0xC0, 0xFF, 0x87, 0xC0, 0xF0, 0x10, 0x1B, 0x30, 0xF0, 0x80, 0x9F, 0xFF,
+  0xC0, 0xFF, 0xFF, 0xC0, 0x7F, 0x3F, 0x3F, 0x1F, 0x0C, 0x07, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define berlin_width 60
+#define berlin_height 60
+const char berlin_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xC0, 0xC0, 0x40, 0x40, 0x68, 0x68, 0xFF, 0x68, 0x60, 0x40, 0x40, 0xC0,
+  0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xE0, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x3C, 0xFC, 0xED, 0x2F, 0xAF, 0x2F, 0xEC, 0x3C, 0x38, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x38, 0x70, 0xC0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x07,
+  0x81, 0x80, 0xC0, 0xF0, 0x18, 0x18, 0x18, 0x18, 0x70, 0x60, 0x20, 0x60,
+  0xC0, 0xE0, 0xBE, 0xBF, 0xD7, 0x9E, 0x7E, 0x1E, 0xF3, 0x3E, 0x7E, 0xE0,
+  0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x0E, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x06, 0x0F,
+  0x19, 0x19, 0x19, 0x19, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0xF8,
+  0xF9, 0x79, 0x79, 0x79, 0x79, 0x79, 0x6F, 0x66, 0x7F, 0x60, 0x69, 0xE0,
+  0xE1, 0xFF, 0x08, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00,
+  0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x78,
+  0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x03, 0xE7, 0xBF, 0xBD, 0xAD, 0xAD, 0xBD, 0xBD, 0xF7, 0xE7, 0x03,
+  0x21, 0xF0, 0x98, 0x8E, 0x8F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x83, 0x83,
+  0xE3, 0x3E, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x07, 0x0E, 0x0C, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0x80,
+  0x80, 0x80, 0x9E, 0xFF, 0xFF, 0x1E, 0x7E, 0x1E, 0xFF, 0xFF, 0x8E, 0x80,
+  0x80, 0x80, 0xC0, 0xC0, 0x60, 0x20, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define cape_town_width 60
+#define cape_town_height 60
+const char cape_town_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0x70, 0xC0, 0xC0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xC0, 0xC0, 0xF8, 0xCE, 0xCF, 0x6B, 0x69, 0x4B, 0xCF, 0xFC, 0xF8, 0xC0,
+  0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xE0, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x01, 0x01, 0xC1, 0xC0,
+  0xFF, 0xFF, 0xC1, 0xC0, 0xCC, 0xDE, 0xD2, 0xDE, 0xC0, 0xC1, 0xC1, 0xFF,
+  0xC0, 0xC0, 0x81, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x38, 0x70, 0xC0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x27,
+  0x21, 0x70, 0xF8, 0xDE, 0xF8, 0x70, 0x20, 0x20, 0xA0, 0xE0, 0x63, 0x7F,
+  0x36, 0x17, 0x1B, 0x0C, 0x07, 0x07, 0x03, 0x07, 0x07, 0x0C, 0x1B, 0x37,
+  0x3E, 0x7F, 0xE3, 0xE0, 0xA0, 0x20, 0x20, 0x70, 0xF8, 0xDE, 0xF8, 0x70,
+  0x23, 0x3E, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x60, 0x60,
+  0x60, 0x60, 0x78, 0xF8, 0x6C, 0x6E, 0x6F, 0x6B, 0xE9, 0x68, 0x68, 0xE8,
+  0x68, 0x68, 0x68, 0x68, 0xE8, 0xE8, 0x68, 0xE8, 0xE8, 0x68, 0x68, 0x68,
+  0xE8, 0xE8, 0x68, 0xE8, 0xE9, 0x6B, 0x6E, 0x6E, 0x6C, 0xF8, 0x78, 0x60,
+  0x60, 0x60, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x78,
+  0xE0, 0x80, 0x00, 0xFF, 0xFF, 0x0F, 0x0F, 0xFF, 0xFF, 0x00, 0x80, 0x8F,
+  0xFF, 0x8F, 0x8F, 0xFF, 0xFF, 0x81, 0x80, 0x89, 0xFF, 0x8F, 0x8F, 0x8F,
+  0xFF, 0x81, 0x00, 0x01, 0xFF, 0xFF, 0x0F, 0x0F, 0xFF, 0x0F, 0x00, 0x80,
+  0xE0, 0x38, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x07, 0x0F, 0x0F, 0x18, 0x30, 0x7F, 0x7F, 0xC0, 0xFF, 0xFF,
+  0xE6, 0xF6, 0x9E, 0x1E, 0xF6, 0xE6, 0x06, 0xF6, 0xFE, 0x1E, 0x9E, 0xF6,
+  0x86, 0xFF, 0xFF, 0xC0, 0x7F, 0x3F, 0x30, 0x18, 0x0F, 0x06, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define dublin_width 60
+#define dublin_height 60
+const char dublin_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x40, 0xF0, 0x78, 0x58, 0x78, 0xF0, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xF8, 0x58, 0x58, 0xF8, 0xF0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0x93, 0x92, 0x9B, 0xFF, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xC0, 0xC0, 0x40, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x40, 0xC0,
+  0xC0, 0x80, 0x80, 0x80, 0x00, 0xFC, 0xFF, 0x92, 0x92, 0xDB, 0xFF, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xFE, 0xFF, 0x24, 0x24, 0x24, 0xFF, 0xF3, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0xF0, 0xF0, 0x30, 0x30, 0x10, 0x10, 0x10, 0x70, 0x10, 0xF0, 0xE0,
+  0x00, 0x00, 0x01, 0x01, 0x03, 0xFF, 0xFF, 0x24, 0x24, 0xB6, 0xFF, 0xC0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x07,
+  0x01, 0xFF, 0xFF, 0x49, 0x49, 0x49, 0xFF, 0xFF, 0x0C, 0xFE, 0x06, 0x02,
+  0x02, 0x73, 0x23, 0x23, 0x63, 0x02, 0x73, 0x02, 0x73, 0x02, 0x73, 0x23,
+  0x02, 0x02, 0x06, 0xFE, 0x08, 0xFF, 0xFF, 0x49, 0x49, 0x6D, 0xFF, 0x01,
+  0x03, 0x0E, 0x78, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xFF, 0x92, 0x92, 0x92, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0x02, 0xFE, 0xFC,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0xDF, 0x92, 0x92, 0x92, 0xFF, 0x00,
+  0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x72,
+  0xE2, 0x83, 0x03, 0x02, 0x02, 0xC2, 0x73, 0x7B, 0xFA, 0x0B, 0x1A, 0x7A,
+  0x7A, 0x7B, 0x7B, 0x7B, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7A, 0x7B, 0x7B,
+  0x7A, 0x7A, 0x0A, 0xCB, 0xFA, 0x7B, 0xE2, 0xC2, 0x02, 0x02, 0x03, 0x83,
+  0xE2, 0x3E, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x07, 0x0F, 0x0D, 0x1F, 0x30, 0x60, 0x7F, 0xC0, 0xFF, 0xFF,
+  0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0xFF, 0x80, 0xFF, 0xFF,
+  0x81, 0xFF, 0xFF, 0x7F, 0x7F, 0x20, 0x3F, 0x1F, 0x0D, 0x07, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define london_width 60
+#define london_height 60
+const char london_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xC0, 0xE0, 0xF0, 0xBC, 0xBF, 0x33, 0xB8, 0x37, 0xBE, 0x38, 0xF0, 0xE0,
+  0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xE0, 0x30, 0x18, 0x0C, 0x04, 0x06, 0x03, 0x01, 0x01, 0x01, 0xF8,
+  0xF8, 0xDF, 0xC3, 0xD1, 0xC3, 0xC3, 0xD1, 0xC3, 0xC3, 0xD1, 0xC7, 0xDF,
+  0xF8, 0xF8, 0x01, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x38, 0x70, 0xC0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x07,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x04, 0x07,
+  0x84, 0x06, 0xE6, 0xE6, 0x46, 0x64, 0x76, 0x44, 0xC6, 0xE4, 0x86, 0x06,
+  0x07, 0x07, 0x04, 0xFC, 0x30, 0x30, 0x30, 0x20, 0xE0, 0x80, 0x00, 0x00,
+  0x03, 0x0E, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x04, 0x0C,
+  0x18, 0x18, 0x18, 0x30, 0x60, 0x40, 0x40, 0x40, 0x40, 0xFF, 0xC0, 0x08,
+  0xDD, 0x7F, 0xC1, 0x80, 0x00, 0x00, 0x0F, 0x08, 0x88, 0x80, 0xE3, 0x7F,
+  0x49, 0x08, 0x00, 0xFF, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x32, 0x32,
+  0x1E, 0x0C, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x7C,
+  0xE4, 0x84, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x7E, 0xF7, 0xD0,
+  0xD0, 0xD0, 0xD3, 0xD3, 0xD1, 0xD3, 0xD7, 0xD1, 0xD1, 0xD3, 0xD0, 0xD0,
+  0xD0, 0xD0, 0x70, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xE0, 0x38, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x07, 0x0E, 0x0C, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xD8, 0xFF,
+  0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0xFF, 0x58, 0xFF, 0xF8, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xD8, 0xC0, 0x60, 0x20, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define new_york_width 60
+#define new_york_height 60
+const char new_york_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xC0, 0xC0, 0x40, 0xE0, 0xFC, 0x9E, 0x93, 0x9E, 0xFC, 0xE0, 0x40, 0xC0,
+  0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xE0, 0x30, 0x18, 0x0C, 0x04, 0x06, 0x03, 0x01, 0x01, 0x01, 0xC0,
+  0xF0, 0x3C, 0x9F, 0xCF, 0x65, 0x24, 0x24, 0x24, 0x6D, 0xCF, 0x9E, 0x38,
+  0xE0, 0x80, 0x01, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x18, 0xB8, 0xF0, 0xC0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x1F,
+  0x09, 0x08, 0x08, 0x18, 0x18, 0x70, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x48, 0x49, 0x49, 0x49, 0x00, 0xFF, 0xFF, 0x00,
+  0xFF, 0xFF, 0x00, 0x80, 0xE0, 0x60, 0x38, 0x18, 0x0E, 0x07, 0x01, 0x00,
+  0x03, 0x0E, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x27, 0x3C, 0x18, 0x00, 0x00, 0xFF,
+  0x80, 0x80, 0xFF, 0x00, 0x92, 0x92, 0x92, 0x92, 0x00, 0x7F, 0xFF, 0x80,
+  0xFF, 0xFF, 0x00, 0x00, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+  0x02, 0x02, 0x83, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x78,
+  0xE0, 0x80, 0x00, 0x00, 0x00, 0xFC, 0x84, 0x24, 0x04, 0xFE, 0xFF, 0x01,
+  0x00, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x24, 0x24,
+  0x00, 0x01, 0xFF, 0x84, 0x24, 0x04, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x80,
+  0xE0, 0x38, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x07, 0x0E, 0x0F, 0x1F, 0x31, 0x69, 0x69, 0xC9, 0xC9, 0x80,
+  0x80, 0xC9, 0x80, 0x00, 0x49, 0x49, 0x49, 0x49, 0x00, 0x00, 0xC9, 0xC9,
+  0x80, 0x80, 0xC9, 0xC9, 0x69, 0x29, 0x31, 0x1F, 0x0F, 0x06, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define paris_width 60
+#define paris_height 60
+const char paris_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xC0, 0xF8, 0xF8, 0xFC, 0x7E, 0x4E, 0x7B, 0x4E, 0xFE, 0xC8, 0xF8, 0xF0,
+  0xC0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xE0, 0x30, 0x18, 0x0C, 0x04, 0x06, 0x03, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0xFD, 0x7F, 0x3F, 0xFF, 0x3F, 0xFF, 0xF1, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x38, 0x70, 0xC0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x47,
+  0x41, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xC0, 0xFE, 0xFF, 0x33, 0x3E, 0xFF, 0x3E, 0x33, 0xFF, 0xFC, 0x00,
+  0x1E, 0x12, 0x13, 0x33, 0x33, 0xF3, 0xB3, 0x13, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x0E, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x60, 0x60,
+  0x60, 0x60, 0x66, 0x67, 0x67, 0x66, 0x66, 0x26, 0x3C, 0x3C, 0x00, 0x00,
+  0xF0, 0xFF, 0xE1, 0xE1, 0xBB, 0x1F, 0xFF, 0x1F, 0xB3, 0xE1, 0xE7, 0xFE,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x78,
+  0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x3F,
+  0x9B, 0xFF, 0x7F, 0xFF, 0x9F, 0x9B, 0xFF, 0x9B, 0x9F, 0xFB, 0x7F, 0xFF,
+  0x9F, 0x7F, 0xFB, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xE0, 0x38, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x07, 0x0E, 0x0C, 0x18, 0x30, 0x70, 0x7C, 0xCF, 0xC7, 0x87,
+  0xCD, 0xF8, 0xF0, 0xF0, 0xDD, 0x8F, 0xFF, 0x8F, 0xD9, 0xF0, 0xF0, 0xD8,
+  0x8F, 0x87, 0xC7, 0xCF, 0x7C, 0x30, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define san_francisco_width 60
+#define san_francisco_height 60
+const char san_francisco_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x78, 0x48,
+  0x78, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xF8,
+  0x58, 0x48, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0F, 0xFF, 0x0F, 0x0F,
+  0x6F, 0x0F, 0x0F, 0x6C, 0x0C, 0x0C, 0x6C, 0x0C, 0x0C, 0x6C, 0x0F, 0x0F,
+  0x6F, 0x0F, 0x0F, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x06, 0x03, 0xFF, 0x00, 0x00,
+  0xFC, 0x7E, 0xE3, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0E,
+  0xFC, 0x00, 0x00, 0xFF, 0xE3, 0x06, 0x44, 0xFC, 0x38, 0x30, 0x60, 0xC0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x0E,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x37, 0x06, 0x87, 0xB7, 0x86, 0x86, 0xB6, 0x86, 0x86, 0xB6, 0x86, 0x06,
+  0x37, 0x00, 0x00, 0xFF, 0x07, 0x1E, 0xF8, 0xE1, 0x01, 0x01, 0x01, 0x01,
+  0x03, 0x1E, 0xF8, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x02, 0x02,
+  0x02, 0x02, 0x02, 0x22, 0x36, 0x3C, 0x20, 0x20, 0x30, 0x3F, 0x20, 0x30,
+  0x3E, 0xE3, 0xC3, 0xFF, 0x01, 0x01, 0xFF, 0x1F, 0x39, 0xF1, 0xC3, 0xC7,
+  0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x01, 0x87, 0xFE, 0xF8, 0xF0,
+  0xF0, 0xDE, 0x87, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x73,
+  0xC3, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0x03, 0x03,
+  0xEF, 0x09, 0x0D, 0xEF, 0x08, 0x0C, 0xEF, 0x08, 0x0C, 0xEF, 0x08, 0x0D,
+  0xEF, 0x00, 0x00, 0xFF, 0x03, 0x03, 0xFF, 0x03, 0x03, 0xFF, 0x00, 0x80,
+  0xFF, 0x78, 0x1F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x20, 0x60, 0xE0, 0xFF, 0x80, 0x80,
+  0xFC, 0x0E, 0x0E, 0xFE, 0x02, 0x02, 0xFE, 0x02, 0x02, 0xFE, 0x06, 0x0E,
+  0xFC, 0x80, 0xC0, 0xFF, 0x40, 0x60, 0x3F, 0x30, 0x18, 0x0F, 0x07, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01,
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define stockholm_width 60
+#define stockholm_height 60
+const char stockholm_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xD8, 0xD8, 0xD8, 0xF8, 0xF8,
+  0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xC0, 0xC0, 0x40, 0x40, 0xE0, 0xF0, 0xDF, 0xF0, 0xE6, 0x47, 0x46, 0xC6,
+  0xC7, 0x83, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xE0, 0x30, 0x18, 0x0C, 0x04, 0x06, 0x03, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x0C, 0xFE, 0x17, 0xD7, 0xD4, 0xD4, 0xD5, 0x97, 0xFF, 0xFE, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x06, 0x0C, 0x18, 0x38, 0x70, 0xC0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x1F,
+  0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x90, 0xF0, 0xFF, 0xB8, 0xFF, 0x6F, 0x28, 0x6F, 0xDF, 0x3F, 0xFF, 0xB0,
+  0x90, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x33, 0x3E, 0x78, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x18, 0x78,
+  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x78, 0x70, 0xE0, 0x80, 0xC0,
+  0x7F, 0x01, 0x00, 0xF0, 0xF3, 0x16, 0x16, 0x12, 0xF3, 0x00, 0x00, 0x01,
+  0xFF, 0xC0, 0xC0, 0xE0, 0x78, 0x70, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xE0, 0x38, 0x98, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x7E,
+  0xFF, 0xB4, 0x3C, 0x34, 0xBC, 0xBE, 0xBF, 0xBC, 0xB6, 0x3F, 0xB4, 0xBC,
+  0xB4, 0xBC, 0x3C, 0x3F, 0xBF, 0xB4, 0xBC, 0xB4, 0xBF, 0x36, 0xBC, 0xBC,
+  0xBC, 0xBC, 0x36, 0x3F, 0xB4, 0xBE, 0xB7, 0xBC, 0xBC, 0x3C, 0x3C, 0xB6,
+  0xFF, 0x3C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x07, 0x0F, 0x0F, 0x18, 0x30, 0x60, 0x7F, 0xC0, 0xE7, 0xF7,
+  0xB4, 0xF7, 0xC7, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xE7, 0xF7,
+  0xB4, 0xF7, 0xC7, 0x7F, 0x7F, 0x20, 0x30, 0x18, 0x0F, 0x06, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define sydney_width 60
+#define sydney_height 60
+const char sydney_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0xC0, 0x60, 0xB0, 0x90, 0xB0, 0x60, 0xC0, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xF0, 0x38,
+  0xCE, 0xF7, 0x7D, 0x6E, 0xB3, 0xF3, 0xDF, 0xB3, 0xA7, 0x6E, 0xFB, 0xF6,
+  0xDC, 0x38, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xC0, 0xE0, 0x30, 0x18, 0x0C, 0x06, 0xC2, 0x73, 0xFF, 0xEF, 0xF7, 0x9B,
+  0x8D, 0xDE, 0x73, 0xE1, 0xB1, 0xF0, 0xDF, 0xB0, 0xA1, 0x63, 0xFF, 0xCF,
+  0x8D, 0xDB, 0x77, 0xFF, 0xFF, 0xE3, 0xC6, 0x06, 0x0C, 0x18, 0x30, 0xE0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3C, 0x07,
+  0x01, 0x00, 0x00, 0x80, 0xFC, 0x7F, 0x3F, 0xDF, 0xEF, 0xF6, 0x1B, 0x1F,
+  0xFF, 0x06, 0x03, 0xFF, 0x01, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x03, 0x06,
+  0xFF, 0x1F, 0x1E, 0xFE, 0xEF, 0x9F, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+  0x03, 0x0F, 0x7C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x87, 0xFF, 0xFF, 0xCF, 0xEF, 0xAF, 0xAF, 0xAF, 0xAF,
+  0xAF, 0xAB, 0xAF, 0xAF, 0xAB, 0xAF, 0xAF, 0xAF, 0xAB, 0xAF, 0xAF, 0xAB,
+  0xAF, 0xAF, 0xAF, 0xAF, 0xEF, 0xEF, 0x8F, 0xFF, 0xFF, 0x83, 0x80, 0x00,
+  0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x38,
+  0xE0, 0xE0, 0x7F, 0x61, 0xFF, 0x7F, 0x7F, 0x7F, 0x61, 0xFF, 0x61, 0x7F,
+  0x61, 0xFF, 0x7F, 0x7F, 0x7F, 0x61, 0xFF, 0x61, 0x7F, 0x61, 0xFF, 0x7F,
+  0x7F, 0x7F, 0x61, 0xFF, 0x61, 0x7F, 0x61, 0xFF, 0x7F, 0x7F, 0x7F, 0xE0,
+  0xE0, 0x3C, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x03, 0x06, 0x0F, 0x1B, 0x36, 0x26, 0x63, 0x43, 0xC6, 0xC6,
+  0x86, 0x83, 0x83, 0x86, 0x86, 0x03, 0x03, 0x06, 0x86, 0x86, 0x83, 0x83,
+  0x86, 0xC6, 0xC3, 0x63, 0x66, 0x36, 0x16, 0x1B, 0x0F, 0x06, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define tokyo_width 60
+#define tokyo_height 60
+const char tokyo_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xF8, 0xF0,
+  0xB0, 0xB8, 0xB8, 0xB8, 0xBE, 0xBF, 0xB7, 0xBE, 0xBC, 0xB8, 0xB8, 0xB0,
+  0xB0, 0xF0, 0xF8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xE0, 0x70, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0xF3, 0xE1, 0x61, 0x61,
+  0x61, 0x79, 0x7D, 0x7F, 0x7D, 0x6D, 0x7D, 0x6D, 0x7D, 0x6F, 0x7D, 0x79,
+  0x61, 0x61, 0x61, 0xF1, 0xF3, 0x03, 0x06, 0x0C, 0x1C, 0x38, 0x70, 0xC0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7C, 0x0F,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0xC0, 0xC1, 0xC3, 0xFB,
+  0xDF, 0xFF, 0xFB, 0xFF, 0xFF, 0xDB, 0xFB, 0xDB, 0xFF, 0xDB, 0xFB, 0xFF,
+  0xFB, 0xF3, 0xC3, 0xC1, 0xC0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x0F, 0xFC, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x80, 0x83, 0x83, 0xF6, 0xBE, 0xFE,
+  0xB6, 0xF6, 0xF6, 0xFE, 0xFE, 0xB6, 0xF6, 0xB6, 0xFE, 0xB6, 0xF6, 0xF6,
+  0xFE, 0xFE, 0xB6, 0xF6, 0x83, 0x81, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x78,
+  0xE0, 0xB8, 0x7C, 0xEC, 0x78, 0x13, 0xC7, 0xED, 0x6D, 0xFD, 0x7D, 0xED,
+  0x6D, 0xED, 0xED, 0xFD, 0xFD, 0x6D, 0xED, 0x6D, 0xFD, 0x6D, 0xED, 0xED,
+  0xED, 0xFD, 0x7D, 0xED, 0x6D, 0xED, 0x07, 0x3B, 0x7C, 0xEC, 0x78, 0x90,
+  0xE0, 0x38, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x07, 0x0F, 0x1F, 0x1B, 0x3B, 0x7B, 0x7B, 0xFB, 0xDB, 0xFB,
+  0x9B, 0xFB, 0xFB, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0x5B, 0xDB, 0xFB, 0xFB,
+  0xFB, 0xFB, 0xDB, 0xFB, 0x7B, 0x3B, 0x3B, 0x1B, 0x0F, 0x07, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#define wellington_width 60
+#define wellington_height 60
+const char wellington_pages[] PROGMEM= {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xD8, 0xD8, 0xD8, 0xF8, 0xF8,
+  0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80,
+  0xF0, 0xF0, 0x90, 0x90, 0xD0, 0x98, 0xDF, 0x90, 0xD6, 0x97, 0x96, 0xF6,
+  0xE7, 0x83, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x80, 0xE0, 0x30, 0x18, 0x0C, 0x04, 0xF6, 0x3F, 0x2F, 0xE3, 0x21, 0x21,
+  0x21, 0x21, 0x21, 0xFF, 0x3F, 0x31, 0x3F, 0x31, 0x3F, 0xF1, 0x21, 0x21,
+  0x21, 0x21, 0x21, 0xE7, 0x3F, 0x3F, 0xF6, 0x0C, 0x18, 0x38, 0x70, 0xC0,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7C, 0x07,
+  0x01, 0x00, 0xC0, 0x40, 0xFE, 0xFF, 0xCF, 0xCF, 0x43, 0xDF, 0x43, 0xDF,
+  0x43, 0xCF, 0xCF, 0xCF, 0xCF, 0x43, 0xDF, 0x43, 0xDF, 0x43, 0xCF, 0xCF,
+  0xCF, 0xCF, 0x43, 0xDF, 0x43, 0xDF, 0x43, 0xFF, 0xFE, 0xC0, 0xC0, 0x00,
+  0x03, 0x0E, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x00, 0x00,
+  0xF8, 0x08, 0x7F, 0x08, 0x7B, 0x79, 0x79, 0x7B, 0x08, 0x7B, 0x08, 0x7B,
+  0x08, 0x7B, 0x79, 0x79, 0x7B, 0x08, 0x7B, 0x08, 0x7B, 0x08, 0x7B, 0x79,
+  0x79, 0x7B, 0x08, 0x7B, 0x08, 0x7B, 0x08, 0x7B, 0x79, 0x7F, 0x7F, 0x08,
+  0xF8, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x7F,
+  0xEF, 0x83, 0x0F, 0x03, 0xFF, 0xFF, 0x0F, 0x0F, 0x03, 0x0F, 0x03, 0xFF,
+  0x03, 0x0F, 0x0F, 0x0F, 0x0F, 0x03, 0xFF, 0x03, 0x0F, 0x03, 0x0F, 0x0F,
+  0xFF, 0xFF, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0xFF, 0xFF, 0x0F, 0x0F, 0x83,
+  0xFF, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x07, 0x0E, 0x0F, 0x1F, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xFF,
+  0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x80, 0x80,
+  0xFF, 0xFF, 0xC0, 0xC0, 0x60, 0x20, 0x30, 0x1F, 0x0F, 0x06, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
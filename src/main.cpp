@@ -16,7 +16,17 @@
 
 
 // Global vars
-char* webImage       = (char*)malloc(1024 * sizeof(char));
+// Client layers combined for the web frame (see Layers.h),
+// page-major like the display buffer
+char* composedImage  = (char*)malloc(1024 * sizeof(char));
+// Layer of the client that draws now
+char* webImage       = composedImage;
+// Draws into webImage
+SSD1306 webCanvas((uint8_t *) webImage);
+
+// Video frames are streamed straight to the display, see WebSocket.h
+bool          streaming       = false;
+unsigned long lastStreamFrame = 0;
 
 // Change as you like
 const char *ssid         = NULL;
@@ -24,18 +34,27 @@ const char *password     = NULL;
 const char *otaPassword  = "password";
 
 SSD1306          display    (0x3C, D5, D6);
+
+// For a 4-wire SPI display use the hardware SPI pins (D5 clock, D7 data) and
+// SSD1306Spi       spi        (D0, D2, D8);   // RES, DC, CS
+// SSD1306          display    (&spi);
 SSD1306Ui        ui         ( &display );
 
 WebSocketsServer webSocket = WebSocketsServer(81);
 ESP8266WebServer server(80);
 
-#include "icons.h"
+#include "iconPages.h"
+#include "FrameCodec.h"
+#include "FrameSlot.h"
+#include "Mirror.h"
+#include "Layers.h"
+#include "WebCommands.h"
 #include "DrawFunctions.h"
 #include "LoadingFunctions.h"
 
 void setup() {
   Serial.begin(115200);
-  memset(webImage, 0, 1024 * sizeof(uint8_t));
+  memset(composedImage, 0, 1024 * sizeof(uint8_t));
 
   Serial.begin(115200);
 
@@ -53,20 +72,35 @@ void setup() {
   display.setContrast(255);
 
   ui.runLoadingProcess(loadingStages, LOADING_STAGES_COUNT);
+
+  // From now on the display is updated from loop()
+  display.setAsyncFlush(true);
 }
 
 
 void loop() {
-  int timeBudget = ui.update();
+  if (streaming && millis() - lastStreamFrame > STREAM_TIMEOUT) {
+    stopStreaming();
+  }
+
+  int timeBudget = streaming ? STREAM_FLUSH_BUDGET : ui.update();
   unsigned long ms = millis();
 
   ArduinoOTA.handle();
 
   server.handleClient();
   webSocket.loop();
+  presentStreamFrame();
 
   int remainingBudget = timeBudget - (millis() - ms);
 
+  // Use the time left to send the last frame to the display
+  display.flushStep(remainingBudget > 0 ? remainingBudget * 1000 : 0);
+  reportStats();
+  updateMirror();
+
+  remainingBudget = timeBudget - (millis() - ms);
+
   if (remainingBudget > 0) {
     delay(remainingBudget);
   }
@@ -0,0 +1,194 @@
+// Encodings for frames in display page order, see src/FrameCodec.h
+
+// Bytes of a gap that are cheaper to send than to start a new run for
+const DELTA_RUN_HEADER = 2;
+
+// Encode the changes from previous to frame as runs of
+// [skip, count, ...values]. Returns null if the result would
+// be longer than maxLength.
+function encodeDelta(previous, frame, maxLength) {
+	const out = new Uint8Array(maxLength);
+	const size = frame.length;
+	let length = 0;
+	let last = 0;
+	let pos = 0;
+
+	while (pos < size) {
+		if (frame[pos] === previous[pos]) {
+			pos++;
+			continue;
+		}
+
+		// Find the end of the run, bridging gaps that cost less than a header
+		let end = pos + 1;
+		let gap = 0;
+		while (end + gap < size && end - pos + gap < 255) {
+			if (frame[end + gap] === previous[end + gap]) {
+				if (++gap > DELTA_RUN_HEADER) {
+					break;
+				}
+			} else {
+				end += gap + 1;
+				gap = 0;
+			}
+		}
+
+		let skip = pos - last;
+		while (skip > 255) {
+			if (length + DELTA_RUN_HEADER > maxLength) {
+				return null;
+			}
+			out[length++] = 255;
+			out[length++] = 0;
+			skip -= 255;
+		}
+
+		const count = end - pos;
+		if (length + DELTA_RUN_HEADER + count > maxLength) {
+			return null;
+		}
+		out[length++] = skip;
+		out[length++] = count;
+		out.set(frame.subarray(pos, end), length);
+		length += count;
+
+		last = pos = end;
+	}
+	return out.subarray(0, length);
+}
+
+// The bytes from the first to the last change as
+// [offset (uint16 LE), ...values]. Returns null if nothing changed
+// or the result would be longer than maxLength.
+function encodePart(previous, frame, maxLength) {
+	let start = 0;
+	while (start < frame.length && frame[start] === previous[start]) {
+		start++;
+	}
+	if (start === frame.length) {
+		return null;
+	}
+
+	let end = frame.length;
+	while (frame[end - 1] === previous[end - 1]) {
+		end--;
+	}
+	if (2 + end - start > maxLength) {
+		return null;
+	}
+
+	const out = new Uint8Array(2 + end - start);
+	out[0] = start & 0xFF;
+	out[1] = start >> 8;
+	out.set(frame.subarray(start, end), 2);
+	return out;
+}
+
+// The bounding box of the changes in whole pages as
+// [x, y, width, height, ...values in page order]. Returns null if
+// nothing changed or the result would be longer than maxLength.
+function encodeRect(previous, frame, width, maxLength) {
+	let left = width;
+	let right = -1;
+	let top = frame.length;
+	let bottom = -1;
+
+	for (let i = 0; i < frame.length; i++) {
+		if (frame[i] !== previous[i]) {
+			const x = i % width;
+			const page = (i - x) / width;
+			left = Math.min(left, x);
+			right = Math.max(right, x);
+			top = Math.min(top, page);
+			bottom = Math.max(bottom, page);
+		}
+	}
+	if (right < 0) {
+		return null;
+	}
+
+	const rectWidth = right - left + 1;
+	const pages = bottom - top + 1;
+	if (4 + rectWidth * pages > maxLength) {
+		return null;
+	}
+
+	const out = new Uint8Array(4 + rectWidth * pages);
+	out.set([left, top * 8, rectWidth, pages * 8]);
+	for (let p = 0; p < pages; p++) {
+		const start = left + (top + p) * width;
+		out.set(frame.subarray(start, start + rectWidth), 4 + p * rectWidth);
+	}
+	return out;
+}
+
+// Longest run PackBits can express
+const PACKBITS_MAX_RUN = 128;
+
+// PackBits compress a frame. Returns null if the result would
+// be longer than maxLength.
+function encodePackBits(frame, maxLength) {
+	const out = new Uint8Array(maxLength);
+	const size = frame.length;
+	let length = 0;
+	let pos = 0;
+
+	while (pos < size) {
+		// Length of the run starting at pos
+		let run = 1;
+		while (pos + run < size && run < PACKBITS_MAX_RUN && frame[pos + run] === frame[pos]) {
+			run++;
+		}
+
+		if (run >= 2) {
+			if (length + 2 > maxLength) {
+				return null;
+			}
+			out[length++] = 257 - run;
+			out[length++] = frame[pos];
+			pos += run;
+			continue;
+		}
+
+		// Collect literals up to the next run of at least three bytes
+		let end = pos + 1;
+		while (end < size && end - pos < PACKBITS_MAX_RUN) {
+			if (end + 2 < size && frame[end] === frame[end + 1] && frame[end] === frame[end + 2]) {
+				break;
+			}
+			end++;
+		}
+
+		const count = end - pos;
+		if (length + 1 + count > maxLength) {
+			return null;
+		}
+		out[length++] = count - 1;
+		out.set(frame.subarray(pos, end), length);
+		length += count;
+		pos = end;
+	}
+	return out.subarray(0, length);
+}
+
+// Apply a delta to frame in place. Returns false if the data is malformed.
+function decodeDelta(data, frame) {
+	let pos = 0;
+	let i = 0;
+
+	while (i + DELTA_RUN_HEADER <= data.length) {
+		pos += data[i];
+		const count = data[i + 1];
+		i += DELTA_RUN_HEADER;
+
+		if (pos + count > frame.length || count > data.length - i) {
+			return false;
+		}
+		frame.set(data.subarray(i, i + count), pos);
+		pos += count;
+		i += count;
+	}
+	return i === data.length;
+}
+
+module.exports = {encodeDelta, encodePart, encodeRect, encodePackBits, decodeDelta};
@@ -16,6 +16,74 @@ NodeList.prototype.on = NodeList.prototype.addEventListener = function (name, fn
 
 
 const floydSteinberg = require('floyd-steinberg');
+const {encodeDelta, encodePart, encodeRect, encodePackBits, decodeDelta} = require('./frameCodec');
+
+// Binary message types, see src/WebSocket.h
+const MSG_FRAME_PAGE = 0x01;
+const MSG_FRAME_STREAM = 0x02;
+const MSG_FRAME_DELTA = 0x03;
+const MSG_STREAM_DELTA = 0x04;
+const MSG_FRAME_RLE = 0x05;
+const MSG_STREAM_RLE = 0x06;
+const MSG_COMMANDS = 0x07;
+const MSG_ACK = 0x08;
+const MSG_STATS = 0x09;
+const MSG_MIRROR_FRAME = 0x0A;
+const MSG_MIRROR_DELTA = 0x0B;
+const MSG_FRAME_PART = 0x0C;
+const MSG_FRAME_RECT = 0x0D;
+
+// Video frames sent but not yet acknowledged by the device. Frames beyond
+// that are dropped here instead of queueing up in the network.
+const MAX_FRAMES_IN_FLIGHT = 2;
+// The device only acknowledges the frames it accepted. Frames refused,
+// e.g. while another client owns the display, count as lost when no
+// acknowledgement arrived for this many ms.
+const ACK_TIMEOUT = 500;
+
+// Commands inside MSG_COMMANDS, see src/WebCommands.h
+const OP_PIXEL = 0x02;
+const OP_LINE = 0x03;
+const OP_CLEAR = 0x07;
+const OP_NEXT_FRAME = 0x08;
+const OP_PREVIOUS_FRAME = 0x09;
+const OP_AUTO_TRANSITION = 0x0A;
+const OP_MIRROR = 0x0B;
+const OP_PRIORITY = 0x0C;
+
+// Commands are collected for this many ms and sent in one message
+const COMMAND_DELAY = 16;
+// Upper bound for the commands in one message
+const MAX_COMMANDS_LENGTH = 1000;
+
+// Send a full frame at least this often, deltas are only sent in between
+const KEYFRAME_INTERVAL = 60;
+
+// Call fn for every pixel of the line from (x0, y0) to (x1, y1),
+// the same pixels SSD1306::drawLine sets
+function forLinePixels(x0, y0, x1, y1, fn) {
+	const dx = Math.abs(x1 - x0);
+	const dy = -Math.abs(y1 - y0);
+	const sx = x0 < x1 ? 1 : -1;
+	const sy = y0 < y1 ? 1 : -1;
+	let err = dx + dy;
+
+	for (;;) {
+		fn(x0, y0);
+		if (x0 === x1 && y0 === y1) {
+			break;
+		}
+		const e2 = 2 * err;
+		if (e2 >= dy) {
+			err += dy;
+			x0 += sx;
+		}
+		if (e2 <= dx) {
+			err += dx;
+			y0 += sy;
+		}
+	}
+}
 
 class RemoteDisplay {
 
@@ -23,29 +91,254 @@ class RemoteDisplay {
 		this.con = con;
 		this.width = 128;
 		this.height = 64;
+		// Last frame as the device has it, reference for the deltas
+		this.previous = null;
+		this.framesSinceKey = 0;
+		// Commands waiting to be sent
+		this.commands = [];
+		this.commandTimer = null;
+		// Pacing, only used once the device acknowledges frames
+		this.paced = false;
+		this.framesSent = 0;
+		this.framesAcked = 0;
+		this.framesLost = 0;
+		this.lastAck = 0;
+		this.displayRate = 0;
+		// Frame counters of the device, reported once per second
+		this.stats = null;
+		this.onStats = null;
+		// What the display shows, only sent while mirroring
+		this.mirror = null;
+		this.onMirror = null;
+
+		this.con.binaryType = 'arraybuffer';
+		this.con.addEventListener('message', e => this.onMessage(e));
+	}
+
+	onMessage({data}) {
+		if (!(data instanceof ArrayBuffer)) {
+			return;
+		}
+		const message = new Uint8Array(data);
+		if (message[0] === MSG_ACK && message.length >= 4) {
+			this.paced = true;
+			this.framesAcked = message[1] | (message[2] << 8);
+			this.lastAck = Date.now();
+			// A frame counted as lost was accepted after all
+			if (this.framesInFlight() > 0x8000) {
+				this.framesLost = (this.framesSent - this.framesAcked) & 0xFFFF;
+			}
+			this.displayRate = message[3];
+		} else if (message[0] === MSG_STATS && message.length >= 13) {
+			const view = new DataView(data);
+			this.stats = {
+				received: view.getUint32(1, true),
+				displayed: view.getUint32(5, true),
+				dropped: view.getUint32(9, true)
+			};
+			if (this.onStats) {
+				this.onStats(this.stats);
+			}
+		} else if (message[0] === MSG_MIRROR_FRAME && message.length === 1 + this.width * this.height / 8) {
+			this.mirror = message.slice(1);
+			this.showMirror();
+		} else if (message[0] === MSG_MIRROR_DELTA && this.mirror) {
+			if (decodeDelta(message.subarray(1), this.mirror)) {
+				this.showMirror();
+			}
+		}
+	}
+
+	showMirror() {
+		if (this.onMirror) {
+			this.onMirror(this.mirror);
+		}
+	}
+
+	// The device starts with a full frame, then sends the changes
+	setMirror(on) {
+		if (!on) {
+			this.mirror = null;
+		}
+		this.queueCommand(OP_MIRROR, on ? 1 : 0);
+	}
+
+	// Only used by the LAYER_PRIORITY policy, see src/Layers.h
+	setPriority(priority) {
+		this.queueCommand(OP_PRIORITY, priority);
+	}
+
+	// False while the device is still busy with earlier frames
+	canSendFrame() {
+		if (!this.paced) {
+			return true;
+		}
+		if (this.framesInFlight() > 0 && Date.now() - this.lastAck > ACK_TIMEOUT) {
+			this.framesLost += this.framesInFlight();
+		}
+		return this.framesInFlight() < MAX_FRAMES_IN_FLIGHT;
 	}
 
-	drawImage(canvasImageData) {
+	framesInFlight() {
+		return (this.framesSent - this.framesLost - this.framesAcked) & 0xFFFF;
+	}
+
+	frameSent() {
+		// The timeout starts with the first frame in flight
+		if (this.framesInFlight() === 0) {
+			this.lastAck = Date.now();
+		}
+		this.framesSent++;
+	}
+
+	drawImage(canvasImageData, stream = false) {
 		const {width, height} = this;
 		const imgd = floydSteinberg(canvasImageData);
-		const binary = new Uint8Array((imgd.data.length / 4) / 8);
-		for (let x = 0; x < width; x++) {
-			for (let y = 0; y < height; y++) {
+
+		// Pack the pixels in the display's page order:
+		// one byte holds 8 vertical pixels, pages are 8 pixel rows
+		const frame = new Uint8Array(width * height / 8);
+		for (let y = 0; y < height; y++) {
+			for (let x = 0; x < width; x++) {
 				if (imgd.data[x * 4 + y * width * 4] !== 0) {
-					binary[x * Math.floor(height / 8) + Math.floor(y / 8)] |= 1 << (y % 8);
+					frame[x + (y >> 3) * width] |= 1 << (y & 7);
 				}
 			}
 		}
-		this.sendCommand(binary);
+		this.sendFrame(frame, stream);
 		return imgd;
 	}
 
+	// Frames of a video are shown directly, skipping the web frame's image
+	sendFrame(frame, stream) {
+		// Keep the order with the commands drawn before
+		this.sendCommands();
+
+		const {previous} = this;
+		this.previous = frame;
+
+		// Encoded messages have to stay shorter than an old style frame
+		let maxLength = frame.length - 2;
+		let type = stream ? MSG_FRAME_STREAM : MSG_FRAME_PAGE;
+		let payload = frame;
+
+		// The full frames now and then resync devices that missed
+		// the start or also got frames from other clients
+		if (previous && ++this.framesSinceKey < KEYFRAME_INTERVAL) {
+			const delta = encodeDelta(previous, frame, maxLength);
+			if (delta) {
+				type = stream ? MSG_STREAM_DELTA : MSG_FRAME_DELTA;
+				payload = delta;
+				maxLength = delta.length - 1;
+			}
+
+			// One changed area, e.g. a cursor, is cheaper as a partial update.
+			// There is no stream variant, it would end streaming.
+			const part = !stream && encodePart(previous, frame, maxLength);
+			if (part) {
+				type = MSG_FRAME_PART;
+				payload = part;
+				maxLength = part.length - 1;
+			}
+
+			// Same for a small area spread over a few pages
+			const rect = !stream && encodeRect(previous, frame, this.width, maxLength);
+			if (rect) {
+				type = MSG_FRAME_RECT;
+				payload = rect;
+				maxLength = rect.length - 1;
+			}
+		}
+
+		// Use whatever is smallest
+		const packed = maxLength > 0 && encodePackBits(frame, maxLength);
+		if (packed) {
+			type = stream ? MSG_STREAM_RLE : MSG_FRAME_RLE;
+			payload = packed;
+		}
+
+		if (type !== MSG_FRAME_DELTA && type !== MSG_STREAM_DELTA && type !== MSG_FRAME_PART && type !== MSG_FRAME_RECT) {
+			this.framesSinceKey = 0;
+		}
+
+		const message = new Uint8Array(1 + payload.length);
+		message[0] = type;
+		message.set(payload, 1);
+		this.sendCommand(message);
+		this.frameSent();
+	}
+
+	// Send a frame message encoded elsewhere, e.g. by host/encoder.cpp.
+	// The device's frame is unknown afterwards, so the next frame from
+	// here is sent in full.
+	sendEncodedFrame(message) {
+		this.sendCommands();
+		this.previous = null;
+		this.sendCommand(message);
+		this.frameSent();
+	}
+
+	setPreviousPixel(x, y) {
+		if (this.previous && x >= 0 && x < this.width && y >= 0 && y < this.height) {
+			this.previous[x + (y >> 3) * this.width] |= 1 << (y & 7);
+		}
+	}
+
 	drawPixel({x, y}) {
-		this.sendCommand(`d:1:${x}:${y}`);
+		this.setPreviousPixel(x, y);
+		this.queueCommand(OP_PIXEL, x, y);
+	}
+
+	drawLine(from, to) {
+		forLinePixels(from.x, from.y, to.x, to.y, (x, y) => this.setPreviousPixel(x, y));
+		this.queueCommand(OP_LINE, from.x, from.y, to.x, to.y);
 	}
 
 	clear() {
-		this.sendCommand('c');
+		if (this.previous) {
+			this.previous.fill(0);
+		}
+		this.queueCommand(OP_CLEAR);
+	}
+
+	nextFrame() {
+		this.queueCommand(OP_NEXT_FRAME);
+	}
+
+	previousFrame() {
+		this.queueCommand(OP_PREVIOUS_FRAME);
+	}
+
+	enableAutoTransition() {
+		this.queueCommand(OP_AUTO_TRANSITION, 1);
+	}
+
+	disableAutoTransition() {
+		this.queueCommand(OP_AUTO_TRANSITION, 0);
+	}
+
+	// Collect commands so a whole stroke goes out in a few messages
+	queueCommand(...command) {
+		if (this.commands.length + command.length > MAX_COMMANDS_LENGTH) {
+			this.sendCommands();
+		}
+		this.commands.push(...command);
+		if (!this.commandTimer) {
+			this.commandTimer = setTimeout(() => this.sendCommands(), COMMAND_DELAY);
+		}
+	}
+
+	sendCommands() {
+		clearTimeout(this.commandTimer);
+		this.commandTimer = null;
+		if (this.commands.length === 0) {
+			return;
+		}
+		const message = new Uint8Array(1 + this.commands.length);
+		message[0] = MSG_COMMANDS;
+		message.set(this.commands, 1);
+		this.commands = [];
+		this.sendCommand(message);
 	}
 
 	sendCommand(data) {
@@ -62,43 +355,60 @@ class CanvasDisplay {
 		this.canvas = canvas;
 		this.ctx = canvas.getContext('2d');
 		this.isMouseDown = false;
+		// End of the stroke drawn so far
+		this.lastPos = null;
 		this.attachEvents();
 	}
 
 	attachEvents() {
 		this.canvas.addEventListener('mousemove', e => {
 			if (this.isMouseDown) {
-				this.drawPixel(this.getMousePos(e));
+				this.drawStroke(this.getMousePos(e));
 			}
 		});
 
 		this.canvas.addEventListener('touchmove', e => {
 			e.preventDefault();
-			this.drawPixel(this.getTouchPos(e));
+			this.drawStroke(this.getTouchPos(e));
+		});
+
+		this.canvas.addEventListener('touchend', () => {
+			this.lastPos = null;
 		});
 
 		this.canvas.addEventListener('mousedown', e => {
 			this.isMouseDown = true;
-			this.drawPixel(this.getMousePos(e));
+			this.drawStroke(this.getMousePos(e));
 		});
 
 		this.root.addEventListener('mouseup', () => {
 			this.isMouseDown = false;
+			this.lastPos = null;
 		});
 	}
 
-	drawImage(img) {
+	drawImage(img, stream = false) {
 		const {width, height} = this.canvas;
 
 		this.ctx.clearRect(0, 0, width, height);
 		this.ctx.drawImage(img, 0, 0, width, height);
 
 		// Draw on remote
-		const imgd = this.remote.drawImage(this.ctx.getImageData(0, 0, width, height));
+		const imgd = this.remote.drawImage(this.ctx.getImageData(0, 0, width, height), stream);
 
 		this.ctx.putImageData(imgd, 0, 0);
 	}
 
+	// Connect the positions of a stroke, mouse events skip pixels
+	drawStroke(pos) {
+		if (this.lastPos) {
+			this.drawLine(this.lastPos, pos);
+		} else {
+			this.drawPixel(pos);
+		}
+		this.lastPos = pos;
+	}
+
 	drawPixel(pos) {
 		const {x, y} = pos;
 		this.remote.drawPixel(pos);
@@ -106,6 +416,12 @@ class CanvasDisplay {
 		this.ctx.fillRect(x, y, 1, 1);
 	}
 
+	drawLine(from, to) {
+		this.remote.drawLine(from, to);
+		this.ctx.fillStyle = '#FFF';
+		forLinePixels(from.x, from.y, to.x, to.y, (x, y) => this.ctx.fillRect(x, y, 1, 1));
+	}
+
 	clear() {
 		this.remote.clear();
 		this.ctx.clearRect(0, 0, this.canvas.width, this.canvas.height);
@@ -146,12 +462,44 @@ const localDisplay = new CanvasDisplay({
 
 const video = $('video')[0];
 
+const stats = $('#stats')[0];
+remote.onStats = ({received, displayed, dropped}) => {
+	stats.textContent = `Frames received ${received}, displayed ${displayed}, dropped ${dropped}, ${remote.displayRate} updates/s`;
+};
+
+// Draw a frame in display page order
+const mirrorCanvas = $('#mirror')[0];
+const mirrorCtx = mirrorCanvas.getContext('2d');
+remote.onMirror = frame => {
+	const {width, height} = mirrorCanvas;
+	const imgd = mirrorCtx.createImageData(width, height);
+	for (let y = 0; y < height; y++) {
+		for (let x = 0; x < width; x++) {
+			const value = (frame[x + (y >> 3) * width] >> (y & 7)) & 1 ? 255 : 0;
+			const i = (x + y * width) * 4;
+			imgd.data[i] = imgd.data[i + 1] = imgd.data[i + 2] = value;
+			imgd.data[i + 3] = 255;
+		}
+	}
+	mirrorCtx.putImageData(imgd, 0, 0);
+};
+
+$('#mirrorToggle').on('change', e => {
+	remote.setMirror(e.target.checked);
+	if (!e.target.checked) {
+		mirrorCtx.clearRect(0, 0, mirrorCanvas.width, mirrorCanvas.height);
+	}
+});
+
 let drawToCanvas;
 drawToCanvas = () => {
 	if (video.paused || video.ended) {
 		return false;
 	}
-	localDisplay.drawImage(video);
+	// Skip the frame if the device did not catch up yet
+	if (remote.canSendFrame()) {
+		localDisplay.drawImage(video, true);
+	}
 	setTimeout(drawToCanvas, 16);
 };
 
@@ -176,12 +524,47 @@ $('#upload').on('change', e => {
 	reader.readAsDataURL(e.target.files[0]);
 });
 
+// Replay a stream file of the host encoder (host/encoder.cpp): "OLED",
+// version and frames per second, then every message with its length
+// (uint16 LE) in front. Frames can't be skipped, they may be deltas
+// against the one before, so the replay waits while the device is behind.
+let streamTimer = null;
+const playStream = buffer => {
+	const data = new Uint8Array(buffer);
+	const header = String.fromCharCode(...data.subarray(0, 4));
+	if (header !== 'OLED' || data[4] !== 1) {
+		return;
+	}
+	const interval = 1000 / data[5];
+	let pos = 6;
+
+	clearTimeout(streamTimer);
+	const next = () => {
+		if (pos + 2 > data.length) {
+			return;
+		}
+		if (remote.canSendFrame()) {
+			const length = data[pos] | (data[pos + 1] << 8);
+			remote.sendEncodedFrame(data.slice(pos + 2, pos + 2 + length));
+			pos += 2 + length;
+		}
+		streamTimer = setTimeout(next, interval);
+	};
+	next();
+};
+
+$('#stream').on('change', e => {
+	const reader = new FileReader();
+	reader.onload = event => playStream(event.target.result);
+	reader.readAsArrayBuffer(e.target.files[0]);
+});
+
 $('#clear').on('click', () => {
 	localDisplay.clear();
 });
 
-$('button[data-send]').forEach(b => {
+$('button[data-command]').forEach(b => {
 	b.on('click', e => {
-		remote.sendCommand(e.target.dataset.send);
+		remote[e.target.dataset.command]();
 	});
 });